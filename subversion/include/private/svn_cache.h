@@ -185,7 +185,9 @@ typedef struct svn_cache__info_t
  * Creates a new cache in @a *cache_p.  This cache will use @a pool
  * for all of its storage needs.  The elements in the cache will be
  * indexed by keys of length @a klen, which may be APR_HASH_KEY_STRING
- * if they are strings.  Cached values will be copied in and out of
+ * if they are strings.  Prefer a fixed @a klen where all keys have the
+ * same known size; APR_HASH_KEY_STRING makes every access re-measure
+ * the key with strlen().  Cached values will be copied in and out of
  * the cache using @a serialize_func and @a deserialize_func, respectively.
  *
  * If @a deserialize_func is NULL, then the data is returned as an
@@ -1065,6 +1065,47 @@ svn_branch__get_path_by_eid(const svn_branch__state_t *branch,
   return svn_element__tree_get_path_by_eid(elements, eid, result_pool);
 }
 
+/* Return true iff the element EID (which is ELEMENT) in ELEMENTS has the
+ * branch-relative path PATH.
+ *
+ * Match the path components against the parent chain from the end of PATH
+ * backwards, without constructing any path strings. If the parent chain is
+ * incomplete, the element has no path and so does not match.
+ */
+static svn_boolean_t
+element_path_matches(const svn_element__tree_t *elements,
+                     const svn_element__content_t *element,
+                     int eid,
+                     const char *path)
+{
+  const char *tail = path + strlen(path);
+
+  while (eid != elements->root_eid)
+    {
+      apr_size_t name_len;
+
+      if (! element)
+        {
+          /* Mapping is not complete; this element is in effect not present. */
+          return FALSE;
+        }
+      name_len = strlen(element->name);
+      if ((apr_size_t)(tail - path) < name_len
+          || strncmp(tail - name_len, element->name, name_len) != 0)
+        return FALSE;
+      tail -= name_len;
+      if (tail > path)
+        {
+          if (tail[-1] != '/')
+            return FALSE;
+          tail--;
+        }
+      eid = element->parent_eid;
+      element = svn_element__tree_get(elements, eid);
+    }
+  return tail == path;
+}
+
 int
 svn_branch__get_eid_by_path(const svn_branch__state_t *branch,
                             const char *path,
@@ -1075,21 +1116,14 @@ svn_branch__get_eid_by_path(const svn_branch__state_t *branch,
 
   /*SVN_ERR_ASSERT_NO_RETURN(branch->priv->is_flat);*/
 
-  /* ### This is a crude, linear search */
   svn_error_clear(svn_branch__state_get_elements(branch, &elements, scratch_pool));
   for (hi = apr_hash_first(scratch_pool, elements->e_map);
        hi; hi = apr_hash_next(hi))
     {
       int eid = svn_eid__hash_this_key(hi);
-      const char *this_path = svn_element__tree_get_path_by_eid(elements, eid,
-                                                                scratch_pool);
+      svn_element__content_t *element = apr_hash_this_val(hi);
 
-      if (! this_path)
-        {
-          /* Mapping is not complete; this element is in effect not present. */
-          continue;
-        }
-      if (strcmp(path, this_path) == 0)
+      if (element_path_matches(elements, element, eid, path))
         {
           return eid;
         }
@@ -1442,6 +1476,33 @@ history_parse(svn_branch__history_t **history_p,
   return SVN_NO_ERROR;
 }
 
+/* Parse a decimal integer (with optional leading minus sign: EIDs in a
+ * not-yet-finalized txn are negative) at **P, setting *RESULT and advancing
+ * *P past the digits. Return FALSE if no digits are present.
+ */
+static svn_boolean_t
+parse_int(int *result,
+          const char **p)
+{
+  const char *s = *p;
+  svn_boolean_t negative = (*s == '-');
+  int val = 0;
+
+  if (negative)
+    s++;
+  if (*s < '0' || *s > '9')
+    return FALSE;
+  do
+    {
+      val = val * 10 + (*s - '0');
+      s++;
+    }
+  while (*s >= '0' && *s <= '9');
+  *result = negative ? -val : val;
+  *p = s;
+  return TRUE;
+}
+
 /* Parse the mapping for one element.
  */
 static svn_error_t *
@@ -1455,22 +1516,32 @@ parse_element_line(int *eid_p,
 {
   svn_stringbuf_t *line;
   svn_boolean_t eof;
-  char kind[10];
-  int n;
-  int offset;
+  const char *p;
+  const char *kind;
 
   /* Read a line */
   SVN_ERR(svn_stream_readline(stream, &line, "\n", &eof, scratch_pool));
   SVN_ERR_ASSERT(!eof);
 
-  n = sscanf(line->data, "e%d: %9s %d%n",
-             eid_p,
-             kind, parent_eid_p, &offset);
-  SVN_ERR_ASSERT(n >= 3);  /* C std is unclear on whether '%n' counts */
-  SVN_ERR_ASSERT(line->data[offset] == ' ');
-
-  *name_p = apr_pstrdup(result_pool, line->data + offset + 1);
-  *is_subbranch_p = (strcmp(kind, "subbranch") == 0);
+  /* Parse "e<EID>: <KIND> <PARENT-EID> <NAME>" by hand: this runs once
+     per element of every branch parsed, and sscanf's format machinery
+     showed up in that loop. */
+  p = line->data;
+  SVN_ERR_ASSERT(*p == 'e');
+  p++;
+  SVN_ERR_ASSERT(parse_int(eid_p, &p));
+  SVN_ERR_ASSERT(p[0] == ':' && p[1] == ' ');
+  p += 2;
+  kind = p;
+  while (*p && *p != ' ')
+    p++;
+  SVN_ERR_ASSERT(*p == ' ');
+  *is_subbranch_p = (p - kind == 9 && strncmp(kind, "subbranch", 9) == 0);
+  p++;
+  SVN_ERR_ASSERT(parse_int(parent_eid_p, &p));
+  SVN_ERR_ASSERT(*p == ' ');
+
+  *name_p = apr_pstrdup(result_pool, p + 1);
 
   if (strcmp(*name_p, "(null)") == 0)
     *name_p = NULL;
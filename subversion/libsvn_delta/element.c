@@ -48,9 +48,21 @@ svn_eid__hash_set(apr_hash_t *ht,
                   int key,
                   const void *val)
 {
-  int *id_p = apr_pmemdup(apr_hash_pool_get(ht), &key, sizeof(key));
+  /* apr_hash_set() only stores the key pointer when it creates a new
+     entry: a deletion or a replacement of an existing entry can be given
+     a transient key. Only copy the key into the hash pool for a genuine
+     insertion, so that repeatedly re-setting the same eids (as element
+     tree edits do) does not leak a small allocation per call. */
+  if (! val || apr_hash_get(ht, &key, sizeof(key)))
+    {
+      apr_hash_set(ht, &key, sizeof(key), val);
+    }
+  else
+    {
+      int *id_p = apr_pmemdup(apr_hash_pool_get(ht), &key, sizeof(key));
 
-  apr_hash_set(ht, id_p, sizeof(key), val);
+      apr_hash_set(ht, id_p, sizeof(key), val);
+    }
 }
 
 int
@@ -29,6 +29,7 @@
 
 #include "cache.h"
 #include "private/svn_mutex.h"
+#include "private/svn_subr_private.h"
 
 /* The (internal) cache object. */
 typedef struct inprocess_cache_t {
@@ -661,7 +662,7 @@ svn_cache__create_inprocess(svn_cache__t **cache_p,
 
   SVN_ERR_ASSERT(klen == APR_HASH_KEY_STRING || klen >= 1);
 
-  cache->hash = apr_hash_make(pool);
+  cache->hash = svn_hash__make(pool);
   cache->klen = klen;
 
   cache->serialize_func = serialize;
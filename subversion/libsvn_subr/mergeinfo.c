@@ -1922,7 +1922,7 @@ svn_mergeinfo_intersect2(svn_mergeinfo_t *mergeinfo,
   apr_hash_index_t *hi;
   apr_pool_t *iterpool;
 
-  *mergeinfo = apr_hash_make(result_pool);
+  *mergeinfo = svn_hash__make(result_pool);
   iterpool = svn_pool_create(scratch_pool);
 
   /* ### TODO(reint): Do we care about the case when a path in one
@@ -1960,7 +1960,7 @@ svn_mergeinfo_remove2(svn_mergeinfo_t *mergeinfo,
                       apr_pool_t *result_pool,
                       apr_pool_t *scratch_pool)
 {
-  *mergeinfo = apr_hash_make(result_pool);
+  *mergeinfo = svn_hash__make(result_pool);
   return walk_mergeinfo_hash_for_diff(whiteboard, eraser, *mergeinfo, NULL,
                                       consider_inheritance, result_pool,
                                       scratch_pool);
@@ -2082,7 +2082,7 @@ svn_mergeinfo_catalog_t
 svn_mergeinfo_catalog_dup(svn_mergeinfo_catalog_t mergeinfo_catalog,
                           apr_pool_t *pool)
 {
-  svn_mergeinfo_t new_mergeinfo_catalog = apr_hash_make(pool);
+  svn_mergeinfo_t new_mergeinfo_catalog = svn_hash__make(pool);
   apr_hash_index_t *hi;
 
   for (hi = apr_hash_first(pool, mergeinfo_catalog);
@@ -2129,7 +2129,7 @@ svn_mergeinfo_inheritable2(svn_mergeinfo_t *output,
                            apr_pool_t *scratch_pool)
 {
   apr_hash_index_t *hi;
-  svn_mergeinfo_t inheritable_mergeinfo = apr_hash_make(result_pool);
+  svn_mergeinfo_t inheritable_mergeinfo = svn_hash__make(result_pool);
 
   for (hi = apr_hash_first(scratch_pool, mergeinfo);
        hi;
@@ -2243,7 +2243,7 @@ svn_mergeinfo__remove_prefix_from_catalog(svn_mergeinfo_catalog_t *out_catalog,
 
   SVN_ERR_ASSERT(prefix_path[0] == '/');
 
-  *out_catalog = apr_hash_make(pool);
+  *out_catalog = svn_hash__make(pool);
 
   for (hi = apr_hash_first(pool, in_catalog); hi; hi = apr_hash_next(hi))
     {
@@ -2269,7 +2269,7 @@ svn_mergeinfo__add_prefix_to_catalog(svn_mergeinfo_catalog_t *out_catalog,
 {
   apr_hash_index_t *hi;
 
-  *out_catalog = apr_hash_make(result_pool);
+  *out_catalog = svn_hash__make(result_pool);
 
   for (hi = apr_hash_first(scratch_pool, in_catalog);
        hi;
@@ -2300,7 +2300,7 @@ svn_mergeinfo__add_suffix_to_mergeinfo(svn_mergeinfo_t *out_mergeinfo,
 
   SVN_ERR_ASSERT(suffix_relpath && svn_relpath_is_canonical(suffix_relpath));
 
-  *out_mergeinfo = apr_hash_make(result_pool);
+  *out_mergeinfo = svn_hash__make(result_pool);
 
   for (hi = apr_hash_first(scratch_pool, mergeinfo);
        hi;
@@ -2480,7 +2480,7 @@ svn_mergeinfo__filter_catalog_by_ranges(svn_mergeinfo_catalog_t *filtered_cat,
 {
   apr_hash_index_t *hi;
 
-  *filtered_cat = apr_hash_make(result_pool);
+  *filtered_cat = svn_hash__make(result_pool);
   for (hi = apr_hash_first(scratch_pool, catalog);
        hi;
        hi = apr_hash_next(hi))
@@ -2517,7 +2517,7 @@ svn_mergeinfo__filter_mergeinfo_by_ranges(svn_mergeinfo_t *filtered_mergeinfo,
   SVN_ERR_ASSERT(SVN_IS_VALID_REVNUM(oldest_rev));
   SVN_ERR_ASSERT(oldest_rev < youngest_rev);
 
-  *filtered_mergeinfo = apr_hash_make(result_pool);
+  *filtered_mergeinfo = svn_hash__make(result_pool);
 
   if (mergeinfo)
     {
@@ -2558,7 +2558,7 @@ svn_mergeinfo__adjust_mergeinfo_rangelists(svn_mergeinfo_t *adjusted_mergeinfo,
                                            apr_pool_t *scratch_pool)
 {
   apr_hash_index_t *hi;
-  *adjusted_mergeinfo = apr_hash_make(result_pool);
+  *adjusted_mergeinfo = svn_hash__make(result_pool);
 
   if (mergeinfo)
     {
@@ -2644,7 +2644,7 @@ svn_mergeinfo__mergeinfo_from_segments(svn_mergeinfo_t *mergeinfo_p,
                                        const apr_array_header_t *segments,
                                        apr_pool_t *pool)
 {
-  svn_mergeinfo_t mergeinfo = apr_hash_make(pool);
+  svn_mergeinfo_t mergeinfo = svn_hash__make(pool);
   int i;
 
   /* Translate location segments into merge sources and ranges. */
@@ -426,7 +426,22 @@ svn_path_compare_paths(const char *path1,
   assert(is_canonical(path1, path1_len));
   assert(is_canonical(path2, path2_len));
 
-  /* Skip past common prefix. */
+  /* Skip past common prefix, a word at a time. Paths compared together
+     typically share long prefixes, and only the position of the first
+     mismatch matters here, so plain word equality is safe: all the
+     ordering decisions below look at the bytes from I onwards. */
+  while (i + sizeof(apr_uint64_t) <= min_len)
+    {
+      apr_uint64_t chunk1, chunk2;
+
+      memcpy(&chunk1, path1 + i, sizeof(chunk1));
+      memcpy(&chunk2, path2 + i, sizeof(chunk2));
+      if (chunk1 != chunk2)
+        break;
+      i += sizeof(apr_uint64_t);
+    }
+
+  /* Skip past the remainder of the common prefix. */
   while (i < min_len && path1[i] == path2[i])
     ++i;
 
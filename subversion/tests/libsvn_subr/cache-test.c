@@ -100,9 +100,13 @@ deserialize_revnum(void **out,
   return SVN_NO_ERROR;
 }
 
+/* Store and retrieve entries under TWENTY_KEY and THIRTY_KEY in CACHE.
+ * The keys must match the key length that CACHE has been created with. */
 static svn_error_t *
 basic_cache_test(svn_cache__t *cache,
                  svn_boolean_t size_is_one,
+                 const char *twenty_key,
+                 const char *thirty_key,
                  apr_pool_t *pool)
 {
   svn_boolean_t found;
@@ -114,16 +118,18 @@ basic_cache_test(svn_cache__t *cache,
    * actually saved away in the cache's pools. */
   subpool = svn_pool_create(pool);
 
-  SVN_ERR(svn_cache__get((void **) &answer, &found, cache, "twenty", subpool));
+  SVN_ERR(svn_cache__get((void **) &answer, &found, cache, twenty_key,
+                         subpool));
   if (found)
     return svn_error_create(SVN_ERR_TEST_FAILED, NULL,
                             "cache found an entry that wasn't there");
   svn_pool_clear(subpool);
 
-  SVN_ERR(svn_cache__set(cache, "twenty", &twenty, subpool));
+  SVN_ERR(svn_cache__set(cache, twenty_key, &twenty, subpool));
   svn_pool_clear(subpool);
 
-  SVN_ERR(svn_cache__get((void **) &answer, &found, cache, "twenty", subpool));
+  SVN_ERR(svn_cache__get((void **) &answer, &found, cache, twenty_key,
+                         subpool));
   if (! found)
     return svn_error_create(SVN_ERR_TEST_FAILED, NULL,
                             "cache failed to find entry for 'twenty'");
@@ -132,10 +138,11 @@ basic_cache_test(svn_cache__t *cache,
                              "expected 20 but found '%ld'", *answer);
   svn_pool_clear(subpool);
 
-  SVN_ERR(svn_cache__set(cache, "thirty", &thirty, subpool));
+  SVN_ERR(svn_cache__set(cache, thirty_key, &thirty, subpool));
   svn_pool_clear(subpool);
 
-  SVN_ERR(svn_cache__get((void **) &answer, &found, cache, "thirty", subpool));
+  SVN_ERR(svn_cache__get((void **) &answer, &found, cache, thirty_key,
+                         subpool));
   if (! found)
     return svn_error_create(SVN_ERR_TEST_FAILED, NULL,
                             "cache failed to find entry for 'thirty'");
@@ -145,7 +152,8 @@ basic_cache_test(svn_cache__t *cache,
 
   if (size_is_one)
     {
-      SVN_ERR(svn_cache__get((void **) &answer, &found, cache, "twenty", subpool));
+      SVN_ERR(svn_cache__get((void **) &answer, &found, cache, twenty_key,
+                             subpool));
       if (found)
         return svn_error_create(SVN_ERR_TEST_FAILED, NULL,
                                 "cache found entry for 'twenty' that should have "
@@ -172,7 +180,29 @@ test_inprocess_cache_basic(apr_pool_t *pool)
                                       "",
                                       pool));
 
-  return basic_cache_test(cache, TRUE, pool);
+  return basic_cache_test(cache, TRUE, "twenty", "thirty", pool);
+}
+
+static svn_error_t *
+test_inprocess_cache_fixed_key(apr_pool_t *pool)
+{
+  svn_cache__t *cache;
+
+  /* Create a cache with fixed 8-byte keys.  This spares the cache both
+   * the strlen() on every access and the generic string hash, so it is
+   * the preferred setup where all keys have a known size. */
+  SVN_ERR(svn_cache__create_inprocess(&cache,
+                                      serialize_revnum,
+                                      deserialize_revnum,
+                                      sizeof(apr_uint64_t),
+                                      1,
+                                      1,
+                                      TRUE,
+                                      "",
+                                      pool));
+
+  /* The padded literals are exactly sizeof(apr_uint64_t) bytes long. */
+  return basic_cache_test(cache, TRUE, "twenty\0\0", "thirty\0\0", pool);
 }
 
 static svn_error_t *
@@ -200,7 +230,7 @@ test_memcache_basic(const svn_test_opts_t *opts,
                                     prefix,
                                     pool));
 
-  return basic_cache_test(cache, FALSE, pool);
+  return basic_cache_test(cache, FALSE, "twenty", "thirty", pool);
 }
 
 static svn_error_t *
@@ -224,7 +254,7 @@ test_membuffer_cache_basic(apr_pool_t *pool)
                                             FALSE,
                                             pool, pool));
 
-  return basic_cache_test(cache, FALSE, pool);
+  return basic_cache_test(cache, FALSE, "twenty", "thirty", pool);
 }
 
 /* Implements svn_cache__deserialize_func_t */
@@ -600,6 +630,8 @@ static struct svn_test_descriptor_t test_funcs[] =
     SVN_TEST_NULL,
     SVN_TEST_PASS2(test_inprocess_cache_basic,
                    "basic inprocess svn_cache test"),
+    SVN_TEST_PASS2(test_inprocess_cache_fixed_key,
+                   "basic inprocess svn_cache test with fixed-size keys"),
     SVN_TEST_OPTS_PASS(test_memcache_basic,
                        "basic memcache svn_cache test"),
     SVN_TEST_OPTS_PASS(test_memcache_long_key,
@@ -95,6 +95,11 @@ struct svn_min__log_t
   /* List of all deletions we encountered, sorted by path&rev. */
   apr_array_header_t *deletions;
 
+  /* Maps FS path to a sorted apr_array_header_t of svn_revnum_t listing
+   * all revisions operative on that path or any of its sub-nodes.
+   * Lazily populated by svn_min__operative_in_range(). */
+  apr_hash_t *operative_cache;
+
   /* If set, don't show progress nor summary. */
   svn_boolean_t quiet;
 };
@@ -259,7 +264,10 @@ log_entry_receiver(void *baton,
   if (log->head_rev == SVN_INVALID_REVNUM)
     log->head_rev = log_entry->revision;
 
-  /* Show progress. */
+  /* Show progress.  The explicit flush is deliberate: the dots carry no
+   * newline, so without it the user would see nothing until the log has
+   * been received completely.  At once per 1000 revisions, the write()
+   * is well off the hot path. */
   if (log->entries->nelts % 1000 == 0 && !log->quiet)
     {
       SVN_ERR(svn_cmdline_printf(scratch_pool, "."));
@@ -336,6 +344,7 @@ svn_min__log(svn_min__log_t **log,
   result->copies = apr_array_make(result_pool, 1024,
                                   sizeof(svn_min__copy_t *));
   result->deletions = apr_array_make(result_pool, 1024, sizeof(deletion_t *));
+  result->operative_cache = svn_hash__make(result_pool);
   result->quiet = baton->opt_state->quiet;
 
   if (!baton->opt_state->quiet)
@@ -638,6 +647,136 @@ svn_min__operative(svn_min__log_t *log,
   return filter_ranges(log, path, ranges, in_subtree, NULL, result_pool);
 }
 
+/* Comparison function comparing the svn_revnum_t in *LHS and *RHS. */
+static int
+compare_revisions(const void *lhs,
+                  const void *rhs)
+{
+  svn_revnum_t lhs_rev = *(const svn_revnum_t *)lhs;
+  svn_revnum_t rhs_rev = *(const svn_revnum_t *)rhs;
+
+  if (lhs_rev < rhs_rev)
+    return -1;
+
+  return lhs_rev == rhs_rev ? 0 : 1;
+}
+
+/* Return the sorted array of all revisions in LOG that are operative on
+ * PATH or any of its sub-nodes.  The array is shared with LOG; lazily
+ * build it and memoize it in LOG->OPERATIVE_CACHE.
+ *
+ * Note that the lazy cache update makes even read-only log queries
+ * non-reentrant.  Like the rest of this tool, this code assumes a
+ * single thread. */
+static apr_array_header_t *
+operative_revisions(svn_min__log_t *log,
+                    const char *path)
+{
+  apr_pool_t *result_pool = log->entries->pool;
+  apr_array_header_t *result = svn_hash_gets(log->operative_cache, path);
+  int k;
+
+  if (result)
+    return result;
+
+  /* LOG->ENTRIES is ordered by revision, hence so is RESULT. */
+  result = apr_array_make(result_pool, 16, sizeof(svn_revnum_t));
+  for (k = 0; k < log->entries->nelts; ++k)
+    {
+      const log_entry_t *entry = APR_ARRAY_IDX(log->entries, k,
+                                               const log_entry_t *);
+      int l;
+
+      /* Skip revisions not relevant to PATH. */
+      if (!is_relevant(entry->common_base, path))
+        continue;
+
+      /* Look for any changed path within the PATH sub-tree. */
+      for (l = 0; l < entry->paths->nelts; ++l)
+        {
+          const char *changed_path
+            = APR_ARRAY_IDX(entry->paths, l, const char *);
+
+          if (svn_dirent_is_ancestor(path, changed_path))
+            {
+              APR_ARRAY_PUSH(result, svn_revnum_t) = entry->revision;
+              break;
+            }
+        }
+    }
+
+  svn_hash_sets(log->operative_cache, apr_pstrdup(result_pool, path),
+                result);
+
+  return result;
+}
+
+svn_boolean_t
+svn_min__operative_in_range(svn_min__log_t *log,
+                            const char *path,
+                            svn_revnum_t start,
+                            svn_revnum_t end)
+{
+  apr_array_header_t *revisions;
+  int idx;
+
+  /* Auto-complete parameters.  Ranges that we have no log data for must
+   * be kept by the caller, i.e. report them as operative. */
+  if (!SVN_IS_VALID_REVNUM(log->first_rev))
+    return TRUE;
+
+  if (start < log->first_rev || end > log->head_rev)
+    return TRUE;
+
+  /* Probe the per-path index for a hit in [START, END]. */
+  revisions = operative_revisions(log, path);
+  idx = svn_sort__bsearch_lower_bound(revisions, &start, compare_revisions);
+
+  return idx < revisions->nelts
+         && APR_ARRAY_IDX(revisions, idx, svn_revnum_t) <= end;
+}
+
+void
+svn_min__operative_in_ranges(svn_boolean_t *results,
+                             svn_min__log_t *log,
+                             const char *path,
+                             const svn_revnum_t *starts,
+                             const svn_revnum_t *ends,
+                             int count)
+{
+  apr_array_header_t *revisions;
+  int idx, i;
+
+  /* Auto-complete parameters.  Ranges that we have no log data for must
+   * be kept by the caller, i.e. report them as operative. */
+  if (!SVN_IS_VALID_REVNUM(log->first_rev))
+    {
+      for (i = 0; i < count; ++i)
+        results[i] = TRUE;
+
+      return;
+    }
+
+  /* Walk the sorted per-path index and the sorted query ranges in
+   * lock-step. */
+  revisions = operative_revisions(log, path);
+  for (idx = 0, i = 0; i < count; ++i)
+    {
+      if (starts[i] < log->first_rev || ends[i] > log->head_rev)
+        {
+          results[i] = TRUE;
+          continue;
+        }
+
+      while (   idx < revisions->nelts
+             && APR_ARRAY_IDX(revisions, idx, svn_revnum_t) < starts[i])
+        ++idx;
+
+      results[i] = idx < revisions->nelts
+                   && APR_ARRAY_IDX(revisions, idx, svn_revnum_t) <= ends[i];
+    }
+}
+
 svn_rangelist_t *
 svn_min__operative_outside_subtree(svn_min__log_t *log,
                                    const char *path,
@@ -1219,25 +1219,6 @@ remove_lines(svn_min__log_t *log,
   return SVN_NO_ERROR;
 }
 
-/* Return TRUE if revisions START to END are inoperative on PATH, according
- * to LOG.  Use SCRATCH_POOL for temporaries. */
-static svn_boolean_t
-inoperative(svn_min__log_t *log,
-            const char *path,
-            svn_revnum_t start,
-            svn_revnum_t end,
-            apr_pool_t *scratch_pool)
-{
-  svn_merge_range_t range = { 0 };
-  apr_array_header_t *ranges = apr_array_make(scratch_pool, 1, sizeof(&range));
-
-  range.start = start - 1;
-  range.end = end;
-  APR_ARRAY_PUSH(ranges, svn_merge_range_t *) = &range;
-
-  return svn_min__operative(log, path, ranges, scratch_pool)->nelts == 0;
-}
-
 /* Use LOG to determine what revision ranges in MERGEINFO can be combined
  * because the revisions in between them are inoperative on the respective
  * branch (sub-)path.   Combine those revision ranges and update PROGRESS.
@@ -1250,50 +1231,139 @@ shorten_lines(svn_mergeinfo_t mergeinfo,
               progress_t *progress,
               apr_pool_t *scratch_pool)
 {
-  apr_pool_t *iterpool = svn_pool_create(scratch_pool);
-  apr_hash_index_t *hi;
+  apr_array_header_t *sorted;
+  int entry_idx;
+
+  /* Scratch arrays reused for all branch paths, grown on demand.  They
+   * come straight out of SCRATCH_POOL; this function needs no sub-pools
+   * and no per-iteration pool clearing. */
+  int capacity = 0;
+  svn_revnum_t *starts = NULL, *ends = NULL;
+  svn_revnum_t *gap_starts = NULL, *gap_ends = NULL;
+  svn_boolean_t *inheritables = NULL, *operative = NULL;
+  svn_merge_range_t **range_ptrs = NULL;
 
   /* Skip if this operation has not been enabled. */
   if (!opt_state->combine_ranges)
     return SVN_NO_ERROR;
 
-  /* Process each branch independently. */
-  for (hi = apr_hash_first(scratch_pool, mergeinfo);
-       hi;
-       hi = apr_hash_next(hi))
+  /* Process each branch independently, in path order.  Adjacent paths
+   * tend to refer to related branches, keeping the respective log index
+   * data warm in the cache. */
+  sorted = svn_sort__hash(mergeinfo, svn_sort_compare_items_lexically,
+                          scratch_pool);
+  for (entry_idx = 0; entry_idx < sorted->nelts; ++entry_idx)
     {
+      const svn_sort__item_t *item = &APR_ARRAY_IDX(sorted, entry_idx,
+                                                    svn_sort__item_t);
       int source, dest;
-      const char *path = apr_hash_this_key(hi);
-      svn_rangelist_t *ranges = apr_hash_this_val(hi);
+      const char *path = item->key;
+      svn_rangelist_t *ranges = item->value;
+      svn_boolean_t reverse = FALSE;
+      svn_boolean_t mixed = FALSE;
 
       /* Skip edge cases. */
-      if (ranges->nelts < 2 || find_reverse_ranges(ranges, iterpool)->nelts)
+      if (ranges->nelts < 2)
         continue;
 
-      /* Merge ranges where possible. */
-      for (source = 1, dest = 0; source < ranges->nelts; ++source)
+      /* Make sure the scratch arrays are large enough for RANGES. */
+      if (ranges->nelts > capacity)
         {
-          svn_merge_range_t *source_range
+          capacity = MAX(2 * capacity, ranges->nelts);
+          starts = apr_palloc(scratch_pool, capacity * sizeof(*starts));
+          ends = apr_palloc(scratch_pool, capacity * sizeof(*ends));
+          inheritables = apr_palloc(scratch_pool,
+                                    capacity * sizeof(*inheritables));
+          range_ptrs = apr_palloc(scratch_pool,
+                                  capacity * sizeof(*range_ptrs));
+          gap_starts = apr_palloc(scratch_pool,
+                                  capacity * sizeof(*gap_starts));
+          gap_ends = apr_palloc(scratch_pool, capacity * sizeof(*gap_ends));
+          operative = apr_palloc(scratch_pool,
+                                 capacity * sizeof(*operative));
+        }
+
+      /* Unpack RANGES into parallel arrays such that the merge loop below
+       * touches sequential memory instead of chasing one heap-allocated
+       * svn_merge_range_t per element.  This is the only loop that still
+       * dereferences the range pointers; they are visited in order and
+       * were typically allocated in order, too, so hardware prefetching
+       * covers their latency. */
+      for (source = 0; source < ranges->nelts; ++source)
+        {
+          svn_merge_range_t *range
             = APR_ARRAY_IDX(ranges, source, svn_merge_range_t *);
-          svn_merge_range_t *dest_range
-            = APR_ARRAY_IDX(ranges, dest, svn_merge_range_t *);
 
-          svn_pool_clear(iterpool);
+          starts[source] = range->start;
+          ends[source] = range->end;
+          inheritables[source] = range->inheritable;
+          range_ptrs[source] = range;
+        }
 
-          if (   (source_range->inheritable == dest_range->inheritable)
-              && inoperative(log, path, dest_range->end + 1,
-                              source_range->start, iterpool))
+      /* Leave rangelists with reverse or empty ranges alone.  This runs
+       * branchless over the flat arrays, so compilers are free to turn
+       * it into SIMD compares.  Nothing has been mutated up to the
+       * write-back, hence simply skipping the path is enough. */
+      for (source = 0; source < ranges->nelts; ++source)
+        reverse |= (starts[source] >= ends[source]);
+      if (reverse)
+        continue;
+
+      /* Whether a pair gets merged or not, the dest range ends up ending
+       * at ENDS[SOURCE].  So, the gap probed at step SOURCE is always the
+       * one between the original ranges SOURCE-1 and SOURCE, i.e. all gaps
+       * are known up front and sorted.  Query them in one batch. */
+      for (source = 1; source < ranges->nelts; ++source)
+        {
+          gap_starts[source - 1] = ends[source - 1] + 1;
+          gap_ends[source - 1] = starts[source];
+        }
+      svn_min__operative_in_ranges(operative, log, path, gap_starts,
+                                   gap_ends, ranges->nelts - 1);
+
+      /* The dest range always carries the inheritable flag of range
+       * SOURCE-1, because a merge requires equal flags.  So, the whole
+       * merge decision is known up front as well; fold the inheritability
+       * test into OPERATIVE without branching on it.  Real-world
+       * mergeinfo is almost always uniformly inheritable - skip the pass
+       * entirely in that case. */
+      for (source = 1; source < ranges->nelts; ++source)
+        mixed |= (inheritables[source] != inheritables[0]);
+
+      if (mixed)
+        for (source = 1; source < ranges->nelts; ++source)
+          operative[source - 1]
+            = operative[source - 1]
+              | (inheritables[source] != inheritables[source - 1]);
+
+      /* Merge ranges where possible. */
+      for (source = 1, dest = 0; source < ranges->nelts; ++source)
+        {
+          if (!operative[source - 1])
             {
-              dest_range->end = source_range->end;
+              ends[dest] = ends[source];
             }
           else
             {
               ++dest;
-              APR_ARRAY_IDX(ranges, dest, svn_merge_range_t *)
-                = source_range;
+              starts[dest] = starts[source];
+              ends[dest] = ends[source];
+              inheritables[dest] = inheritables[source];
+              range_ptrs[dest] = range_ptrs[source];
             }
         }
 
+      /* Write the surviving ranges back. */
+      for (source = 0; source <= dest; ++source)
+        {
+          svn_merge_range_t *range = range_ptrs[source];
+
+          range->start = starts[source];
+          range->end = ends[source];
+          range->inheritable = inheritables[source];
+          APR_ARRAY_IDX(ranges, source, svn_merge_range_t *) = range;
+        }
+
       /* Update progress. */
       progress->ranges_removed += ranges->nelts - dest - 1;
       ranges->nelts = dest + 1;
@@ -1303,14 +1373,17 @@ shorten_lines(svn_mergeinfo_t mergeinfo,
 }
 
 /* Construct a 1-line progress info based on the PROGRESS and selected
- * processing options in OPT_STATE.  Allocate the result in RESULT_POOL
- * and use SCRATCH_POOL for temporaries. */
+ * processing options in OPT_STATE, ready to be written out as-is, i.e.
+ * including indentation and the final newline.  Allocate the result in
+ * RESULT_POOL and use SCRATCH_POOL for temporaries. */
 static const char *
 progress_string(const progress_t *progress,
                 svn_min__opt_state_t *opt_state,
                 apr_pool_t *result_pool,
                 apr_pool_t *scratch_pool)
 {
+  /* APR_UINT64_T_FMT is platform-dependent and therefore must not appear
+   * within translatable strings; pre-format the numbers instead. */
   const char *obsoletes_str = apr_psprintf(scratch_pool,
                                            "%" APR_UINT64_T_FMT,
                                            progress->obsoletes_removed);
@@ -1321,7 +1394,7 @@ progress_string(const progress_t *progress,
                                         "%" APR_UINT64_T_FMT,
                                         progress->ranges_removed);
 
-  svn_stringbuf_t *result = svn_stringbuf_create_empty(result_pool);
+  svn_stringbuf_t *result = svn_stringbuf_create("    ", result_pool);
   svn_stringbuf_appendcstr(result,
                            apr_psprintf(scratch_pool,
                                         _("Processed %d nodes"),
@@ -1346,6 +1419,8 @@ progress_string(const progress_t *progress,
                                           _(", combined %s ranges"),
                                           ranges_str));
 
+  svn_stringbuf_appendcstr(result, ".\n");
+
   return result->data;
 }
 
@@ -1480,6 +1555,11 @@ normalize(apr_array_header_t *wc_mergeinfo,
   apr_pool_t *iterpool = svn_pool_create(scratch_pool);
   progress_t progress = { 0 };
 
+  /* Hoisted loop-invariant part of the progress reporting condition. */
+  svn_boolean_t show_progress = !opt_state->verbose
+                                && !opt_state->run_analysis
+                                && !opt_state->quiet;
+
   int i;
   progress.nodes_total = wc_mergeinfo->nelts;
   for (i = wc_mergeinfo->nelts - 1; i >= 0; --i)
@@ -1566,12 +1646,12 @@ normalize(apr_array_header_t *wc_mergeinfo,
       SVN_ERR(show_elision_result(parent_mergeinfo, mergeinfo_to_report,
                                   opt_state, scratch_pool));
 
-      /* Print progress info. */
-      if (   !opt_state->verbose && !opt_state->run_analysis
-          && !opt_state->quiet && i % 100 == 0)
-        SVN_ERR(svn_cmdline_printf(iterpool, "    %s.\n",
-                                   progress_string(&progress, opt_state,
-                                                   iterpool, iterpool)));
+      /* Print progress info.  The line is fully formatted already, so
+       * don't run it through another format pass. */
+      if (show_progress && i % 100 == 0)
+        SVN_ERR(svn_cmdline_fputs(progress_string(&progress, opt_state,
+                                                  iterpool, iterpool),
+                                  stdout, iterpool));
     }
 
   svn_pool_destroy(iterpool);
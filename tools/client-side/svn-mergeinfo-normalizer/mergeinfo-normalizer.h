@@ -252,6 +252,27 @@ svn_min__operative(svn_min__log_t *log,
                    svn_rangelist_t *ranges,
                    apr_pool_t *result_pool);
 
+/* Scan LOG and return TRUE if any revision in the range START to END, both
+ * inclusive, operates on PATH or one of its sub-nodes.  Revisions that lie
+ * outside what is covered by LOG count as operative. */
+svn_boolean_t
+svn_min__operative_in_range(svn_min__log_t *log,
+                            const char *path,
+                            svn_revnum_t start,
+                            svn_revnum_t end);
+
+/* Batch version of svn_min__operative_in_range().  For each of the COUNT
+ * revision ranges STARTS[I] to ENDS[I], set RESULTS[I] accordingly.  The
+ * ranges must be given in ascending order of their start revision; LOG is
+ * then consulted in a single pass over its revision index. */
+void
+svn_min__operative_in_ranges(svn_boolean_t *results,
+                             svn_min__log_t *log,
+                             const char *path,
+                             const svn_revnum_t *starts,
+                             const svn_revnum_t *ends,
+                             int count);
+
 /* Scan LOG and determine what revisions in RANGES are operative on PATH
  * but outside SUBTREE (possibly but not exclusively modifying paths within
  * SUBTREE).  Return those revisions, allocated in RESULT_POOL. */
@@ -458,7 +458,8 @@ svn_min__print_mergeinfo_stats(apr_array_header_t *wc_mergeinfo,
   for (i = 0; i < wc_mergeinfo->nelts; ++i)
     {
       apr_hash_index_t *hi;
-      svn_mergeinfo_t mergeinfo = svn_min__get_mergeinfo(wc_mergeinfo, i);
+      svn_mergeinfo_t mergeinfo
+        = APR_ARRAY_IDX(wc_mergeinfo, i, mergeinfo_t *)->mergeinfo;
 
       svn_pool_clear(iterpool);
 
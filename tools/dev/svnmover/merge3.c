@@ -715,6 +715,7 @@ element_merge(svn_element__content_t **result_p,
   svn_boolean_t same2 = svn_element__content_equal(yca, side2, scratch_pool);
   svn_boolean_t conflict = FALSE;
   svn_element__content_t *result = NULL;
+  svn_element__content_t result_scratch;
 
   if (same1)
     {
@@ -726,8 +727,14 @@ element_merge(svn_element__content_t **result_p,
     }
   else if (yca && side1 && side2)
     {
-      /* All three sides are different, and all exist */
-      result = apr_pmemdup(result_pool, yca, sizeof(*result));
+      /* All three sides are different, and all exist.
+
+         Assemble the merged element on the stack; it is copied into
+         RESULT_POOL at the end, and only if the merge didn't conflict
+         (a conflicting result is discarded), avoiding a small pool
+         allocation per conflicting element. */
+      result_scratch = *yca;
+      result = &result_scratch;
 
       /* merge the parent-eid */
       if (side1->parent_eid == yca->parent_eid)
@@ -832,12 +839,66 @@ element_merge(svn_element__content_t **result_p,
       conflict = TRUE;
     }
 
+  if (result == &result_scratch)
+    result = conflict ? NULL
+                      : apr_pmemdup(result_pool, &result_scratch,
+                                    sizeof(result_scratch));
+
   *result_p = result;
   *conflict_p
     = conflict ? element_merge3_conflict_create(yca, side1, side2,
                                                 result_pool) : NULL;
 }
 
+/* The type of element_merge() and of its specializations. */
+typedef void (*element_merge_func_t)(svn_element__content_t **result_p,
+                                     element_merge3_conflict_t **conflict_p,
+                                     int eid,
+                                     svn_element__content_t *side1,
+                                     svn_element__content_t *side2,
+                                     svn_element__content_t *yca,
+                                     const merge_conflict_policy_t *policy,
+                                     apr_pool_t *result_pool,
+                                     apr_pool_t *scratch_pool);
+
+/* A specialization of element_merge() for the all-lenient policy: the
+ * policy tests become compile-time constants here and can be folded away.
+ * POLICY is ignored.
+ */
+static void
+element_merge_lenient(svn_element__content_t **result_p,
+                      element_merge3_conflict_t **conflict_p,
+                      int eid,
+                      svn_element__content_t *side1,
+                      svn_element__content_t *side2,
+                      svn_element__content_t *yca,
+                      const merge_conflict_policy_t *policy,
+                      apr_pool_t *result_pool,
+                      apr_pool_t *scratch_pool)
+{
+  static const merge_conflict_policy_t lenient
+    = { TRUE, TRUE, TRUE, TRUE, TRUE };
+
+  element_merge(result_p, conflict_p, eid, side1, side2, yca,
+                &lenient, result_pool, scratch_pool);
+}
+
+/* Return the specialization of element_merge() to use for POLICY: a
+ * fixed-policy variant if one matches, else the generic function. The
+ * choice is made once per subtree merge, not once per element.
+ */
+static element_merge_func_t
+element_merge_specialization(const merge_conflict_policy_t *policy)
+{
+  if (policy->merge_double_delete
+      && policy->merge_double_add
+      && policy->merge_double_reparent
+      && policy->merge_double_rename
+      && policy->merge_double_modify)
+    return element_merge_lenient;
+  return element_merge;
+}
+
 static svn_error_t *
 branch_merge_subtree_r(svn_branch__txn_t *edit_txn,
                        svn_branch__state_t *edit_branch,
@@ -1183,6 +1244,8 @@ branch_merge_subtree_r(svn_branch__txn_t *edit_txn,
   apr_hash_t *all_elements;
   svn_eid__hash_iter_t *ei;
   const merge_conflict_policy_t policy = { TRUE, TRUE, TRUE, TRUE, TRUE };
+  element_merge_func_t merge_func = element_merge_specialization(&policy);
+  int src_root_eid, tgt_root_eid, yca_root_eid;
   apr_pool_t *iterpool = svn_pool_create(scratch_pool);
 
   /*SVN_DBG(("merge src: r%2ld %s e%3d",
@@ -1237,6 +1300,12 @@ branch_merge_subtree_r(svn_branch__txn_t *edit_txn,
                                        all_elements,
                                        scratch_pool, scratch_pool));
 
+  /* Each branch's root eid is fixed for the whole merge; look the three
+     up once rather than through a state-vtable call per element below. */
+  src_root_eid = svn_branch__root_eid(src->branch);
+  tgt_root_eid = svn_branch__root_eid(tgt->branch);
+  yca_root_eid = svn_branch__root_eid(yca->branch);
+
   for (SVN_EID__HASH_ITER_SORTED_BY_EID(ei, all_elements, scratch_pool))
     {
       int eid = ei->eid;
@@ -1279,9 +1348,9 @@ branch_merge_subtree_r(svn_branch__txn_t *edit_txn,
          (If we merged it, it could break the single-rooted-tree invariant
          of the target branch.)
        */
-      if (is_branch_root_element(src->branch, eid)
-          || is_branch_root_element(tgt->branch, eid)
-          || is_branch_root_element(yca->branch, eid))
+      if (eid == src_root_eid
+          || eid == tgt_root_eid
+          || eid == yca_root_eid)
         {
           e_src = svn_element__content_create(
                     e_tgt->parent_eid, e_tgt->name, e_src->payload, iterpool);
@@ -1289,10 +1358,10 @@ branch_merge_subtree_r(svn_branch__txn_t *edit_txn,
                     e_tgt->parent_eid, e_tgt->name, e_yca->payload, iterpool);
         }
 
-      element_merge(&result, &conflict,
-                    eid, e_src, e_tgt, e_yca,
-                    &policy,
-                    scratch_pool, scratch_pool);
+      merge_func(&result, &conflict,
+                 eid, e_src, e_tgt, e_yca,
+                 &policy,
+                 scratch_pool, scratch_pool);
 
       if (conflict)
         {
@@ -565,9 +565,10 @@ svn_ra_get_commit_txn(svn_ra_session_t *session,
 
   /* Convert to Ev3 */
   {
-    const char *repos_root_url;
-
-    SVN_ERR(svn_ra_get_repos_root2(session, &repos_root_url, pool));
+    /* The repository root URL was already fetched (in POOL) when the
+       branching state was loaded; don't ask the RA layer again. */
+    const char *repos_root_url
+      = ((struct fb_baton *)fetch_baton)->repos_root_url;
 
     /*SVN_ERR(svn_delta__get_debug_editor(&deditor, &dedit_baton,
                                           deditor, dedit_baton, "", pool));*/
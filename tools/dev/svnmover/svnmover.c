@@ -120,10 +120,14 @@ static svn_boolean_t use_coloured_output = FALSE;
 #define TEXT_BG_CYAN    "\x1b[46m"
 #define TEXT_BG_WHITE   "\x1b[47m"
 
+/* No fflush here: the attribute bytes order correctly with the
+ * surrounding stdout text anyway, and flushing twice per notification
+ * defeats stdio's buffering on bulk output. We flush explicitly before
+ * prompting and at exit. */
 #define settext(text_attr) \
   do { \
     if (use_coloured_output) \
-      { fputs(text_attr, stdout); fflush(stdout); } \
+      fputs(text_attr, stdout); \
   } while (0)
 #define settext_stderr(text_attr) \
   do { \
@@ -314,12 +318,12 @@ svnmover_wc_get_base_revs_r(svnmover_wc_t *wc,
                                                   scratch_pool);
       svn_element__content_t *element;
 
-      if (*base_rev_min == SVN_INVALID_REVNUM
-          || rev < *base_rev_min)
-        *base_rev_min = rev;
-      if (*base_rev_max == SVN_INVALID_REVNUM
-          || rev > *base_rev_max)
-        *base_rev_max = rev;
+      /* Conditional-move-friendly min/max selects. A valid revnum always
+         exceeds SVN_INVALID_REVNUM (-1), so the max needs no validity
+         test, and the min needs it only to absorb its initial value. */
+      *base_rev_max = (rev > *base_rev_max) ? rev : *base_rev_max;
+      *base_rev_min = (*base_rev_min == SVN_INVALID_REVNUM
+                       || rev < *base_rev_min) ? rev : *base_rev_min;
 
       /* recurse into nested branches */
       SVN_ERR(svn_branch__state_get_element(branch, &element, eid,
@@ -1359,6 +1363,64 @@ static const action_defn_t action_defn[] =
     "migrate changes from non-move-tracking revision"},
 };
 
+#define ACTION_DEFN_COUNT (sizeof(action_defn) / sizeof(action_defn[0]))
+
+/* Return a table of pointers to the entries of ACTION_DEFN[], sorted by
+ * name, built on first use. (ACTION_DEFN[] itself stays in its original
+ * order, which the 'help' output presents.) Lazily building the index is
+ * safe as svnmover is single-threaded.
+ */
+static const action_defn_t **
+action_defn_index(void)
+{
+  static const action_defn_t
+    *defn_by_name[ACTION_DEFN_COUNT];
+
+  if (! defn_by_name[0])
+    {
+      int i;
+
+      for (i = 0; i < ACTION_DEFN_COUNT; i++)
+        {
+          int j;
+
+          for (j = i;
+               j > 0 && strcmp(action_defn[i].name,
+                               defn_by_name[j - 1]->name) < 0;
+               j--)
+            defn_by_name[j] = defn_by_name[j - 1];
+          defn_by_name[j] = &action_defn[i];
+        }
+    }
+  return defn_by_name;
+}
+
+/* Look up NAME in ACTION_DEFN[] by binary search on the sorted index,
+ * returning its entry, or NULL if NAME is not a known action.
+ */
+static const action_defn_t *
+find_action_defn(const char *name)
+{
+  const action_defn_t **defn_by_name = action_defn_index();
+  int lo, hi;
+
+  lo = 0;
+  hi = ACTION_DEFN_COUNT;
+  while (lo < hi)
+    {
+      int mid = (lo + hi) / 2;
+      int diff = strcmp(name, defn_by_name[mid]->name);
+
+      if (diff == 0)
+        return defn_by_name[mid];
+      else if (diff < 0)
+        hi = mid;
+      else
+        lo = mid + 1;
+    }
+  return NULL;
+}
+
 typedef struct action_t {
   /* The original command words (const char *) by which the action was
      specified */
@@ -1461,6 +1523,45 @@ find_el_rev_by_rrpath_rev(svn_branch__el_rev_id_t **el_rev_p,
   return SVN_NO_ERROR;
 }
 
+/* Like find_el_rev_by_rrpath_rev(), but memoize results in EL_REV_CACHE,
+ * keyed by (REV_SPEC, BRANCH_ID, RELPATH).
+ *
+ * A cached resolution is only valid as long as the branching state does
+ * not change, so callers should use one cache per action. Return a copy
+ * of the cached id, as some callers modify the returned id in place.
+ */
+static svn_error_t *
+find_el_rev_cached(svn_branch__el_rev_id_t **el_rev_p,
+                   svnmover_wc_t *wc,
+                   const svn_opt_revision_t *rev_spec,
+                   const char *branch_id,
+                   const char *relpath,
+                   apr_hash_t *el_rev_cache,
+                   apr_pool_t *result_pool,
+                   apr_pool_t *scratch_pool)
+{
+  const char *key
+    = apr_psprintf(apr_hash_pool_get(el_rev_cache), "%d:%ld:%s:%s",
+                   (int)rev_spec->kind,
+                   rev_spec->kind == svn_opt_revision_number
+                     ? rev_spec->value.number : 0,
+                   branch_id ? branch_id : "",
+                   relpath);
+  svn_branch__el_rev_id_t *el_rev = svn_hash_gets(el_rev_cache, key);
+
+  if (! el_rev)
+    {
+      SVN_ERR(find_el_rev_by_rrpath_rev(&el_rev, wc, rev_spec, branch_id,
+                                        relpath,
+                                        apr_hash_pool_get(el_rev_cache),
+                                        scratch_pool));
+      svn_hash_sets(el_rev_cache, key, el_rev);
+    }
+  *el_rev_p = svn_branch__el_rev_id_create(el_rev->branch, el_rev->eid,
+                                           el_rev->rev, result_pool);
+  return SVN_NO_ERROR;
+}
+
 /* Return a string suitable for appending to a displayed element name or
  * element id to indicate that it is a subbranch root element for SUBBRANCH.
  * Return "" if SUBBRANCH is null.
@@ -1545,6 +1646,42 @@ sort_compare_eid_mappings_by_path(const svn_sort__item_t *a,
   return svn_path_compare_paths(astr, bstr);
 }
 
+/* Return the branch-relative path of element EID in ELEMENTS, or NULL if
+ * the element or one of its ancestors is not present.
+ *
+ * Memoize each result in PATHS (eid -> relpath), so that listing a whole
+ * tree costs one parent-chain walk per element in total, rather than one
+ * per element listed.
+ */
+static const char *
+element_relpath(apr_hash_t *paths,
+                svn_element__tree_t *elements,
+                int eid,
+                apr_pool_t *result_pool)
+{
+  const char *relpath = svn_eid__hash_get(paths, eid);
+
+  if (relpath)
+    return relpath;
+  if (eid == elements->root_eid)
+    relpath = "";
+  else
+    {
+      svn_element__content_t *element = svn_element__tree_get(elements, eid);
+      const char *parent_relpath;
+
+      if (! element)
+        return NULL;
+      parent_relpath
+        = element_relpath(paths, elements, element->parent_eid, result_pool);
+      if (! parent_relpath)
+        return NULL;
+      relpath = svn_relpath_join(parent_relpath, element->name, result_pool);
+    }
+  svn_eid__hash_set(paths, eid, relpath);
+  return relpath;
+}
+
 /* List the elements in BRANCH, in path notation.
  *
  * List only the elements for which a relpath is known -- that is, elements
@@ -1564,10 +1701,8 @@ list_branch_elements(svn_branch__state_t *branch,
        hi; hi = apr_hash_next(hi))
     {
       int eid = svn_eid__hash_this_key(hi);
-      const char *relpath = svn_branch__get_path_by_eid(branch, eid,
-                                                        scratch_pool);
 
-      svn_eid__hash_set(eid_to_path, eid, relpath);
+      element_relpath(eid_to_path, elements, eid, scratch_pool);
     }
   for (SVN_EID__HASH_ITER_SORTED(ei, eid_to_path,
                                  sort_compare_eid_mappings_by_path,
@@ -2006,9 +2141,51 @@ typedef struct diff_item_t
   int eid;
   svn_element__content_t *e0, *e1;
   const char *relpath0, *relpath1;
+  /* The right-hand relpath if the element exists on the right-hand side
+     of the diff, else the left-hand relpath. Precomputed so the sort
+     comparator need not re-derive it on every comparison. */
+  const char *major_path;
+  /* First bytes of MAJOR_PATH packed into an integer whose unsigned
+     comparison agrees with svn_path_compare_paths(); valid only when
+     ABBREV_OK. Orders most pairs without re-reading the paths. */
+  apr_uint64_t abbrev_key;
+  svn_boolean_t abbrev_ok;
+  svn_boolean_t deleted;
   svn_boolean_t modified, reparented, renamed;
 } diff_item_t;
 
+/* Compute an abbreviated sort key holding the first bytes of PATH,
+ * remapped ('/' -> 1) so that unsigned comparison of two keys agrees
+ * with svn_path_compare_paths() whenever the paths differ within the
+ * key. Set *KEY_OK to FALSE if PATH contains a byte for which that
+ * agreement does not hold; such a key must not be used.
+ */
+static apr_uint64_t
+path_abbrev_key(const char *path,
+                svn_boolean_t *key_ok)
+{
+  apr_uint64_t key = 0;
+  int i;
+
+  *key_ok = TRUE;
+  if (! path)
+    return 0;
+  for (i = 0; i < 8 && path[i]; i++)
+    {
+      unsigned char c = (unsigned char)path[i];
+
+      /* Non-ASCII bytes compare as signed chars in the full comparator,
+         and byte 1 would collide with the remapped '/'. */
+      if (c >= 0x80 || c == 1)
+        {
+          *key_ok = FALSE;
+          return 0;
+        }
+      key |= (apr_uint64_t)(c == '/' ? 1 : c) << (8 * (7 - i));
+    }
+  return key;
+}
+
 /* Return differences between branch subtrees S_LEFT and S_RIGHT.
  * Diff the union of S_LEFT's and S_RIGHT's elements.
  *
@@ -2027,6 +2204,9 @@ subtree_diff(apr_hash_t **diff_changes,
 {
   apr_hash_t *diff_left_right;
   apr_hash_index_t *hi;
+  apr_hash_t *paths_left = apr_hash_make(scratch_pool);
+  apr_hash_t *paths_right = apr_hash_make(scratch_pool);
+  diff_item_t *items;
 
   *diff_changes = apr_hash_make(result_pool);
 
@@ -2035,6 +2215,11 @@ subtree_diff(apr_hash_t **diff_changes,
                                        NULL /*union of s_left & s_right*/,
                                        result_pool, scratch_pool));
 
+  /* One contiguous block for all the items, rather than a small pool
+     allocation apiece; the hash values point into it. */
+  items = apr_palloc(result_pool,
+                     apr_hash_count(diff_left_right) * sizeof(*items));
+
   for (hi = apr_hash_first(scratch_pool, diff_left_right);
        hi; hi = apr_hash_next(hi))
     {
@@ -2044,15 +2229,22 @@ subtree_diff(apr_hash_t **diff_changes,
 
       if (e0 || e1)
         {
-          diff_item_t *item = apr_palloc(result_pool, sizeof(*item));
+          diff_item_t *item = items++;
 
           item->eid = eid;
           item->e0 = e0;
           item->e1 = e1;
-          item->relpath0 = e0 ? svn_element__tree_get_path_by_eid(
-                                  s_left->tree, eid, result_pool) : NULL;
-          item->relpath1 = e1 ? svn_element__tree_get_path_by_eid(
-                                  s_right->tree, eid, result_pool) : NULL;
+          /* Use memoized path look-ups: a straight
+             svn_element__tree_get_path_by_eid would walk the parent chain
+             afresh for each element of the subtree. */
+          item->relpath0 = e0 ? element_relpath(paths_left, s_left->tree,
+                                                eid, result_pool) : NULL;
+          item->relpath1 = e1 ? element_relpath(paths_right, s_right->tree,
+                                                eid, result_pool) : NULL;
+          item->major_path = e1 ? item->relpath1 : item->relpath0;
+          item->abbrev_key = path_abbrev_key(item->major_path,
+                                             &item->abbrev_ok);
+          item->deleted = (e0 && ! e1);
           item->reparented = (e0 && e1 && e0->parent_eid != e1->parent_eid);
           item->renamed = (e0 && e1 && strcmp(e0->name, e1->name) != 0);
 
@@ -2074,17 +2266,17 @@ diff_ordering_major_paths(const struct svn_sort__item_t *a,
                           const struct svn_sort__item_t *b)
 {
   const diff_item_t *item_a = a->value, *item_b = b->value;
-  int deleted_a = (item_a->e0 && ! item_a->e1);
-  int deleted_b = (item_b->e0 && ! item_b->e1);
-  const char *major_path_a = (item_a->e1 ? item_a->relpath1 : item_a->relpath0);
-  const char *major_path_b = (item_b->e1 ? item_b->relpath1 : item_b->relpath0);
 
   /* Sort deleted items before all others */
-  if (deleted_a != deleted_b)
-    return deleted_b - deleted_a;
-
-  /* Sort by path */
-  return svn_path_compare_paths(major_path_a, major_path_b);
+  if (item_a->deleted != item_b->deleted)
+    return item_b->deleted - item_a->deleted;
+
+  /* Sort by path: the abbreviated keys settle most pairs without
+     touching the path strings. */
+  if (item_a->abbrev_ok && item_b->abbrev_ok
+      && item_a->abbrev_key != item_b->abbrev_key)
+    return (item_a->abbrev_key < item_b->abbrev_key) ? -1 : 1;
+  return svn_path_compare_paths(item_a->major_path, item_b->major_path);
 }
 
 /* Display differences between subtrees LEFT and RIGHT, which are subtrees
@@ -2111,10 +2303,18 @@ show_subtree_diff(svn_branch__subtree_t *left,
 {
   apr_hash_t *diff_changes;
   svn_eid__hash_iter_t *ei;
+  svn_stringbuf_t *from_buf = svn_stringbuf_create_empty(scratch_pool);
+  svn_stringbuf_t *out = svn_stringbuf_create_empty(scratch_pool);
+  svn_boolean_t left_has_subbranches, right_has_subbranches;
 
   SVN_ERR_ASSERT(left && left->tree->root_eid != -1
                  && right && right->tree->root_eid != -1);
 
+  /* Most diffs involve no nested branches; remember whether each side has
+     any so the per-element subbranch annotation lookup can be skipped. */
+  left_has_subbranches = (apr_hash_count(left->subbranches) > 0);
+  right_has_subbranches = (apr_hash_count(right->subbranches) > 0);
+
   SVN_ERR(subtree_diff(&diff_changes, left, right,
                        scratch_pool, scratch_pool));
 
@@ -2129,7 +2329,15 @@ show_subtree_diff(svn_branch__subtree_t *left,
     {
       diff_item_t *item = ei->val;
       svn_element__content_t *e0 = item->e0, *e1 = item->e1;
-      char status_mod = (e0 && e1) ? 'M' : e0 ? 'D' : 'A';
+      /* Indexed by (e0 present)*2 + (e1 present); at least one is set. */
+      static const char status_tab[] = { '?', 'A', 'D', 'M' };
+      char status_mod = status_tab[((e0 != NULL) << 1) | (e1 != NULL)];
+      const char *subbranch
+        = (e0 ? left_has_subbranches : right_has_subbranches)
+            ? subtree_subbranch_str(e0 ? left : right,
+                                    e0 ? left_bid : right_bid,
+                                    item->eid, scratch_pool)
+            : "";
 
       /* For a deleted element whose parent was also deleted, mark it is
          less interesting, somehow. (Or we could omit it entirely.) */
@@ -2144,54 +2352,90 @@ show_subtree_diff(svn_branch__subtree_t *left,
 
       if (the_ui_mode == UI_MODE_PATHS)
         {
-          const char *major_path = (e1 ? item->relpath1 : item->relpath0);
+          const char *major_path = item->major_path;
           const char *from = "";
 
           if (item->reparented || item->renamed)
             {
+              /* Assemble the annotation in a stringbuf reused across the
+                 loop, rather than apr_psprintf'ing each item. */
+              svn_stringbuf_setempty(from_buf);
               if (! item->reparented)
-                from = apr_psprintf(scratch_pool,
-                                    " (renamed from .../%s)",
-                                    e0->name);
+                {
+                  svn_stringbuf_appendcstr(from_buf, " (renamed from .../");
+                  svn_stringbuf_appendcstr(from_buf, e0->name);
+                  svn_stringbuf_appendbyte(from_buf, ')');
+                }
               else if (! item->renamed)
-                from = apr_psprintf(scratch_pool,
-                                    " (moved from %s/...)",
-                                    svn_relpath_dirname(item->relpath0,
-                                                        scratch_pool));
+                {
+                  const char *base = svn_relpath_basename(item->relpath0,
+                                                          NULL);
+                  apr_size_t dirlen
+                    = (base == item->relpath0)
+                        ? 0 : (apr_size_t)(base - item->relpath0 - 1);
+
+                  svn_stringbuf_appendcstr(from_buf, " (moved from ");
+                  svn_stringbuf_appendbytes(from_buf, item->relpath0, dirlen);
+                  svn_stringbuf_appendcstr(from_buf, "/...)");
+                }
               else
-                from = apr_psprintf(scratch_pool,
-                                    " (moved+renamed from %s)",
-                                    item->relpath0);
+                {
+                  svn_stringbuf_appendcstr(from_buf, " (moved+renamed from ");
+                  svn_stringbuf_appendcstr(from_buf, item->relpath0);
+                  svn_stringbuf_appendbyte(from_buf, ')');
+                }
+              from = from_buf->data;
             }
-          svnmover_notify("%s%c%c%c %s%s%s",
-                          prefix,
-                          status_mod,
-                          item->reparented ? 'v' : ' ',
-                          item->renamed ? 'r' : ' ',
-                          major_path,
-                          subtree_subbranch_str(e0 ? left : right,
-                                                e0 ? left_bid : right_bid,
-                                                item->eid, scratch_pool),
-                          from);
+          svn_stringbuf_appendcstr(out, prefix);
+          svn_stringbuf_appendbyte(out, status_mod);
+          svn_stringbuf_appendbyte(out, item->reparented ? 'v' : ' ');
+          svn_stringbuf_appendbyte(out, item->renamed ? 'r' : ' ');
+          svn_stringbuf_appendbyte(out, ' ');
+          svn_stringbuf_appendcstr(out, major_path);
+          svn_stringbuf_appendcstr(out, subbranch);
+          svn_stringbuf_appendcstr(out, from);
+          svn_stringbuf_appendbyte(out, '\n');
         }
       else
         {
-          svnmover_notify("%s%c%c%c e%-3d  %s%s%s%s%s",
-                          prefix,
-                          status_mod,
-                          item->reparented ? 'v' : ' ',
-                          item->renamed ? 'r' : ' ',
-                          item->eid,
-                          e1 ? peid_name(e1, scratch_pool) : "",
-                          subtree_subbranch_str(e0 ? left : right,
-                                                e0 ? left_bid : right_bid,
-                                                item->eid, scratch_pool),
-                          e0 && e1 ? " (from " : "",
-                          e0 ? peid_name(e0, scratch_pool) : "",
-                          e0 && e1 ? ")" : "");
+          /* Append the pieces directly rather than going through the
+             printf format machinery for every row. */
+          const char *eid_str = apr_itoa(scratch_pool, item->eid);
+          apr_size_t eid_len = strlen(eid_str);
+
+          svn_stringbuf_appendcstr(out, prefix);
+          svn_stringbuf_appendbyte(out, status_mod);
+          svn_stringbuf_appendbyte(out, item->reparented ? 'v' : ' ');
+          svn_stringbuf_appendbyte(out, item->renamed ? 'r' : ' ');
+          svn_stringbuf_appendcstr(out, " e");
+          svn_stringbuf_appendcstr(out, eid_str);
+          for (; eid_len < 3; eid_len++)
+            svn_stringbuf_appendbyte(out, ' ');
+          svn_stringbuf_appendcstr(out, "  ");
+          if (e1)
+            svn_stringbuf_appendcstr(out, peid_name(e1, scratch_pool));
+          svn_stringbuf_appendcstr(out, subbranch);
+          if (e0)
+            {
+              if (e1)
+                svn_stringbuf_appendcstr(out, " (from ");
+              svn_stringbuf_appendcstr(out, peid_name(e0, scratch_pool));
+              if (e1)
+                svn_stringbuf_appendbyte(out, ')');
+            }
+          svn_stringbuf_appendbyte(out, '\n');
         }
     }
 
+  /* Emit the whole listing in one go: with coloured output each notify
+     costs a couple of extra writes and flushes, which dominated large
+     diffs when paid per line. */
+  if (out->len > 0)
+    {
+      svn_stringbuf_chop(out, 1);  /* drop the last newline; notify adds it */
+      svnmover_notify("%s", out->data);
+    }
+
   return SVN_NO_ERROR;
 }
 
@@ -2204,6 +2448,90 @@ svn_branch__diff_func_t(svn_branch__subtree_t *left,
                         const char *header,
                         apr_pool_t *scratch_pool);
 
+static svn_error_t *
+subtree_diff_r(svn_branch__state_t *left_branch,
+               int left_root_eid,
+               svn_branch__state_t *right_branch,
+               int right_root_eid,
+               svn_branch__diff_func_t diff_func,
+               const char *prefix,
+               apr_hash_t *rrpath_cache,
+               apr_pool_t *scratch_pool);
+
+/* Return the repository-relative path of the root of BRANCH, as
+ * svn_branch__get_root_rrpath() does, but memoize the result in
+ * RRPATH_CACHE, keyed by the branch state's address. Finding the root
+ * rrpath walks the outer-branch chain, so without the cache a recursive
+ * diff recomputes the outer prefixes at every nesting level.
+ */
+static const char *
+branch_root_rrpath_cached(svn_branch__state_t *branch,
+                          apr_hash_t *rrpath_cache)
+{
+  apr_pool_t *cache_pool = apr_hash_pool_get(rrpath_cache);
+  const char *rrpath = apr_hash_get(rrpath_cache, &branch, sizeof(branch));
+
+  if (! rrpath)
+    {
+      svn_branch__state_t **key = apr_pmemdup(cache_pool, &branch,
+                                              sizeof(branch));
+
+      rrpath = svn_branch__get_root_rrpath(branch, cache_pool);
+      apr_hash_set(rrpath_cache, key, sizeof(branch), rrpath);
+    }
+  return rrpath;
+}
+
+/* Display differences between the subbranch rooted at element E of
+ * LEFT_BRANCH and/or of RIGHT_BRANCH (each of which may be null).
+ *
+ * Recurse into sub-branches.
+ */
+static svn_error_t *
+subbranch_diff_r(svn_branch__state_t *left_branch,
+                 svn_branch__state_t *right_branch,
+                 int e,
+                 svn_branch__diff_func_t diff_func,
+                 const char *prefix,
+                 apr_hash_t *rrpath_cache,
+                 apr_pool_t *scratch_pool)
+{
+  svn_branch__state_t *left_subbranch = NULL, *right_subbranch = NULL;
+  int left_subbranch_eid = -1, right_subbranch_eid = -1;
+
+  if (left_branch)
+    {
+      SVN_ERR(svn_branch__get_subbranch_at_eid(left_branch, &left_subbranch, e,
+                                               scratch_pool));
+      if (left_subbranch)
+        {
+          left_subbranch_eid = svn_branch__root_eid(left_subbranch);
+        }
+    }
+  if (right_branch)
+    {
+      SVN_ERR(svn_branch__get_subbranch_at_eid(right_branch, &right_subbranch, e,
+                                               scratch_pool));
+      if (right_subbranch)
+        {
+          right_subbranch_eid = svn_branch__root_eid(right_subbranch);
+        }
+    }
+  /* If both sides are the same branch state, or the same branch at the
+     same committed (and thus immutable) revision, the subtrees cannot
+     differ: prune the whole recursion. */
+  if (left_subbranch && right_subbranch
+      && (left_subbranch == right_subbranch
+          || (SVN_IS_VALID_REVNUM(left_subbranch->txn->rev)
+              && left_subbranch->txn->rev == right_subbranch->txn->rev
+              && strcmp(left_subbranch->bid, right_subbranch->bid) == 0)))
+    return SVN_NO_ERROR;
+  SVN_ERR(subtree_diff_r(left_subbranch, left_subbranch_eid,
+                         right_subbranch, right_subbranch_eid,
+                         diff_func, prefix, rrpath_cache, scratch_pool));
+  return SVN_NO_ERROR;
+}
+
 /* Display differences between subtrees LEFT and RIGHT.
  *
  * Recurse into sub-branches.
@@ -2215,6 +2543,7 @@ subtree_diff_r(svn_branch__state_t *left_branch,
                int right_root_eid,
                svn_branch__diff_func_t diff_func,
                const char *prefix,
+               apr_hash_t *rrpath_cache,
                apr_pool_t *scratch_pool)
 {
   svn_branch__subtree_t *left = NULL;
@@ -2223,16 +2552,15 @@ subtree_diff_r(svn_branch__state_t *left_branch,
     = left_branch
         ? apr_psprintf(scratch_pool, "%s:e%d at /%s",
                        left_branch->bid, left_root_eid,
-                       svn_branch__get_root_rrpath(left_branch, scratch_pool))
+                       branch_root_rrpath_cached(left_branch, rrpath_cache))
         : NULL;
   const char *right_str
     = right_branch
         ? apr_psprintf(scratch_pool, "%s:e%d at /%s",
                        right_branch->bid, right_root_eid,
-                       svn_branch__get_root_rrpath(right_branch, scratch_pool))
+                       branch_root_rrpath_cached(right_branch, rrpath_cache))
             : NULL;
   const char *header;
-  apr_hash_t *subbranches_l, *subbranches_r, *subbranches_all;
   apr_hash_index_t *hi;
 
   if (left_branch)
@@ -2279,40 +2607,34 @@ subtree_diff_r(svn_branch__state_t *left_branch,
                         scratch_pool));
     }
 
-  /* recurse into each subbranch that exists in LEFT and/or in RIGHT */
-  subbranches_l = left ? left->subbranches : apr_hash_make(scratch_pool);
-  subbranches_r = right ? right->subbranches : apr_hash_make(scratch_pool);
-  subbranches_all = hash_overlay(subbranches_l, subbranches_r);
-
-  for (hi = apr_hash_first(scratch_pool, subbranches_all);
-       hi; hi = apr_hash_next(hi))
+  /* Recurse into each subbranch that exists in LEFT and/or in RIGHT:
+     first all of LEFT's, then those of RIGHT's not already visited,
+     rather than materializing an overlay hash of the union. */
+  if (left)
     {
-      int e = svn_eid__hash_this_key(hi);
-      svn_branch__state_t *left_subbranch = NULL, *right_subbranch = NULL;
-      int left_subbranch_eid = -1, right_subbranch_eid = -1;
-
-      /* recurse */
-      if (left_branch)
+      for (hi = apr_hash_first(scratch_pool, left->subbranches);
+           hi; hi = apr_hash_next(hi))
         {
-          SVN_ERR(svn_branch__get_subbranch_at_eid(left_branch, &left_subbranch, e,
-                                                   scratch_pool));
-          if (left_subbranch)
-            {
-              left_subbranch_eid = svn_branch__root_eid(left_subbranch);
-            }
+          int e = svn_eid__hash_this_key(hi);
+
+          SVN_ERR(subbranch_diff_r(left_branch, right_branch, e,
+                                   diff_func, prefix, rrpath_cache,
+                                   scratch_pool));
         }
-      if (right_branch)
+    }
+  if (right)
+    {
+      for (hi = apr_hash_first(scratch_pool, right->subbranches);
+           hi; hi = apr_hash_next(hi))
         {
-          SVN_ERR(svn_branch__get_subbranch_at_eid(right_branch, &right_subbranch, e,
-                                                   scratch_pool));
-          if (right_subbranch)
-            {
-              right_subbranch_eid = svn_branch__root_eid(right_subbranch);
-            }
+          int e = svn_eid__hash_this_key(hi);
+
+          if (left && svn_eid__hash_get(left->subbranches, e))
+            continue;
+          SVN_ERR(subbranch_diff_r(left_branch, right_branch, e,
+                                   diff_func, prefix, rrpath_cache,
+                                   scratch_pool));
         }
-      SVN_ERR(subtree_diff_r(left_subbranch, left_subbranch_eid,
-                             right_subbranch, right_subbranch_eid,
-                             diff_func, prefix, scratch_pool));
     }
   return SVN_NO_ERROR;
 }
@@ -2328,9 +2650,11 @@ branch_diff_r(svn_branch__el_rev_id_t *left,
               const char *prefix,
               apr_pool_t *scratch_pool)
 {
+  apr_hash_t *rrpath_cache = apr_hash_make(scratch_pool);
+
   SVN_ERR(subtree_diff_r(left->branch, left->eid,
                          right->branch, right->eid,
-                         diff_func, prefix, scratch_pool));
+                         diff_func, prefix, rrpath_cache, scratch_pool));
   return SVN_NO_ERROR;
 }
 
@@ -2379,21 +2703,21 @@ do_mkdir(svn_branch__txn_t *txn,
          svn_branch__state_t *to_branch,
          svn_branch__eid_t to_parent_eid,
          const char *new_name,
+         apr_hash_t *props,
          apr_pool_t *scratch_pool)
 {
-  apr_hash_t *props = apr_hash_make(scratch_pool);
   svn_element__payload_t *payload
     = svn_element__payload_create_dir(props, scratch_pool);
   int new_eid;
-  const char *path = branch_peid_name_to_path(to_branch, to_parent_eid,
-                                              new_name, scratch_pool);
 
   SVN_ERR(svn_branch__txn_new_eid(txn, &new_eid, scratch_pool));
   SVN_ERR(svn_branch__state_alter_one(to_branch, new_eid,
                                       to_parent_eid, new_name, payload,
                                       scratch_pool));
-  svnmover_notify_v("A    %s",
-                    path);
+  if (! quiet)
+    svnmover_notify_v("A    %s",
+                      branch_peid_name_to_path(to_branch, to_parent_eid,
+                                               new_name, scratch_pool));
   return SVN_NO_ERROR;
 }
 
@@ -2404,6 +2728,8 @@ do_put_file(svn_branch__txn_t *txn,
             svn_branch__el_rev_id_t *file_el_rev,
             svn_branch__el_rev_id_t *parent_el_rev,
             const char *file_name,
+            svn_stringbuf_t **put_buf,
+            apr_pool_t *buf_pool,
             apr_pool_t *scratch_pool)
 {
   apr_hash_t *props;
@@ -2426,18 +2752,68 @@ do_put_file(svn_branch__txn_t *txn,
     {
       props = apr_hash_make(scratch_pool);
     }
-  /* read new text from file */
-  {
-    svn_stream_t *src;
-
-    if (strcmp(local_file_path, "-") != 0)
+  /* Read the new text into *PUT_BUF, a buffer allocated in BUF_POOL and
+     reused across put actions: the payload creation below copies the
+     text, so nothing keeps pointing into the buffer. */
+  if (! *put_buf)
+    *put_buf = svn_stringbuf_create_ensure(SVN__STREAM_CHUNK_SIZE, buf_pool);
+  text = *put_buf;
+  svn_stringbuf_setempty(text);
+
+  if (strcmp(local_file_path, "-") != 0)
+    {
+      apr_finfo_t finfo;
+      svn_stream_t *src;
+      char *chunk = apr_palloc(scratch_pool, SVN__STREAM_CHUNK_SIZE);
+      apr_size_t len;
+
+      /* Size the buffer from a stat so that, for a regular file, a single
+         full read normally suffices instead of growing the buffer by
+         repeated doubling.  For anything else (FIFOs, /proc entries, ...)
+         the reported size is meaningless -- often 0 with no error, cf.
+         stringbuf_from_aprfile() -- so those get nothing but the
+         read-to-EOF loop below. */
+      SVN_ERR(svn_io_stat(&finfo, local_file_path,
+                          APR_FINFO_SIZE | APR_FINFO_TYPE, scratch_pool));
       SVN_ERR(svn_stream_open_readonly(&src, local_file_path,
                                        scratch_pool, scratch_pool));
-    else
-      SVN_ERR(svn_stream_for_stdin2(&src, FALSE, scratch_pool));
+      if (finfo.filetype == APR_REG)
+        {
+          svn_stringbuf_ensure(text, (apr_size_t)finfo.size);
+          len = (apr_size_t)finfo.size;
+          SVN_ERR(svn_stream_read_full(src, text->data, &len));
+          text->len = len;
+          text->data[len] = '\0';
+        }
+      /* Pick up whatever the sized read did not cover: the whole content
+         for non-regular files, or bytes appended since the stat. */
+      do
+        {
+          len = SVN__STREAM_CHUNK_SIZE;
+          SVN_ERR(svn_stream_read_full(src, chunk, &len));
+          svn_stringbuf_appendbytes(text, chunk, len);
+        }
+      while (len == SVN__STREAM_CHUNK_SIZE);
+      SVN_ERR(svn_stream_close(src));
+    }
+  else
+    {
+      svn_stream_t *src;
+      char *chunk = apr_palloc(scratch_pool, SVN__STREAM_CHUNK_SIZE);
+      apr_size_t len;
 
-    SVN_ERR(svn_stringbuf_from_stream(&text, src, 0, scratch_pool));
-  }
+      SVN_ERR(svn_stream_for_stdin2(&src, FALSE, scratch_pool));
+      do
+        {
+          len = SVN__STREAM_CHUNK_SIZE;
+          SVN_ERR(svn_stream_read_full(src, chunk, &len));
+          svn_stringbuf_appendbytes(text, chunk, len);
+        }
+      while (len == SVN__STREAM_CHUNK_SIZE);
+    }
+  /* This copies TEXT: the payload API stores only self-contained
+     immutable payloads, and has no stream-based variant. That copy is
+     the one the element tree keeps; the read above adds no others. */
   payload = svn_element__payload_create_file(props, text, scratch_pool);
 
   if (is_branch_root_element(file_el_rev->branch,
@@ -2454,28 +2830,27 @@ do_put_file(svn_branch__txn_t *txn,
 
   if (file_el_rev->eid != -1)
     {
-      const char *path = el_rev_id_to_path(file_el_rev, scratch_pool);
-
       SVN_ERR(svn_branch__state_alter_one(file_el_rev->branch, file_el_rev->eid,
                                           parent_eid, name, payload,
                                           scratch_pool));
-      svnmover_notify_v("M    %s",
-                        path);
+      if (! quiet)
+        svnmover_notify_v("M    %s",
+                          el_rev_id_to_path(file_el_rev, scratch_pool));
     }
   else
     {
       int new_eid;
-      const char *path
-        = branch_peid_name_to_path(parent_el_rev->branch, parent_eid, name,
-                                   scratch_pool);
 
       SVN_ERR(svn_branch__txn_new_eid(txn, &new_eid, scratch_pool));
       SVN_ERR(svn_branch__state_alter_one(parent_el_rev->branch, new_eid,
                                           parent_eid, name, payload,
                                           scratch_pool));
       file_el_rev->eid = new_eid;
-      svnmover_notify_v("A    %s",
-                        path);
+      if (! quiet)
+        svnmover_notify_v("A    %s",
+                          branch_peid_name_to_path(parent_el_rev->branch,
+                                                   parent_eid, name,
+                                                   scratch_pool));
     }
   return SVN_NO_ERROR;
 }
@@ -2584,23 +2959,31 @@ do_log(svn_branch__el_rev_id_t *left,
        apr_pool_t *scratch_pool)
 {
   svn_revnum_t first_rev = left->rev;
+  apr_pool_t *iterpool = svn_pool_create(scratch_pool);
 
   while (right->rev > first_rev)
     {
       svn_branch__el_rev_id_t *el_rev_left;
 
+      svn_pool_clear(iterpool);
+
+      /* The predecessor id becomes the next iteration's right side, so
+         allocate it in SCRATCH_POOL, not in the iterpool. It is computed
+         once per revision and reused for both the diff and the loop
+         step. */
       SVN_ERR(svn_branch__find_predecessor_el_rev(&el_rev_left, right, scratch_pool));
 
       svnmover_notify(SVN_CL__LOG_SEP_STRING "r%ld | ...",
                       right->rev);
       svnmover_notify("History:");
-      SVN_ERR(show_history_r(right->branch, "   ", scratch_pool));
+      SVN_ERR(show_history_r(right->branch, "   ", iterpool));
       svnmover_notify("Changed elements:");
       SVN_ERR(branch_diff_r(el_rev_left, right,
                             show_subtree_diff, "   ",
-                            scratch_pool));
+                            iterpool));
       right = el_rev_left;
     }
+  svn_pool_destroy(iterpool);
 
   return SVN_NO_ERROR;
 }
@@ -2925,6 +3308,7 @@ do_interactive_cross_branch_move(svn_branch__txn_t *txn,
       "We can do one of these for you now if you wish.\n"
     ));
 
+  fflush(stdout);
   settext_stderr(TEXT_FG_YELLOW);
   err = svn_cmdline_prompt_user2(
           &input,
@@ -2984,20 +3368,29 @@ do_move(svn_branch__el_rev_id_t *el_rev,
         const char *to_name,
         apr_pool_t *scratch_pool)
 {
-  const char *from_path = el_rev_id_to_path(el_rev, scratch_pool);
-  const char *to_path
-    = branch_peid_name_to_path(to_parent_el_rev->branch,
-                               to_parent_el_rev->eid, to_name, scratch_pool);
+  const char *from_path = NULL;
+  const char *to_path = NULL;
   /* New payload shall be the same as before */
   svn_element__content_t *existing_element;
 
+  /* The paths serve only the verbose notification, and each one costs a
+     parent-chain walk; the 'from' path must be fetched before the move. */
+  if (! quiet)
+    {
+      from_path = el_rev_id_to_path(el_rev, scratch_pool);
+      to_path = branch_peid_name_to_path(to_parent_el_rev->branch,
+                                         to_parent_el_rev->eid, to_name,
+                                         scratch_pool);
+    }
+
   SVN_ERR(svn_branch__state_get_element(el_rev->branch, &existing_element,
                                         el_rev->eid, scratch_pool));
   SVN_ERR(svn_branch__state_alter_one(el_rev->branch, el_rev->eid,
                             to_parent_el_rev->eid, to_name,
                             existing_element->payload, scratch_pool));
-  svnmover_notify_v("V    %s (from %s)",
-                    to_path, from_path);
+  if (! quiet)
+    svnmover_notify_v("V    %s (from %s)",
+                      to_path, from_path);
   return SVN_NO_ERROR;
 }
 
@@ -3323,47 +3716,69 @@ typedef struct arg_t
   svn_branch__el_rev_id_t *el_rev, *parent_el_rev;
 } arg_t;
 
+/* Each macro binds the el-rev it examines to a block-local pointer, so a
+ * chain of verifications dereferences arg[i] once apiece; the error
+ * message arguments are only evaluated on the failure path. */
 #define VERIFY_REV_SPECIFIED(op, i)                                     \
-  if (arg[i]->el_rev->rev == SVN_INVALID_REVNUM)                        \
-    return svn_error_createf(SVN_BRANCH__ERR, NULL,                   \
-                             _("%s: '%s': revision number required"),   \
-                             op, action->relpath[i]);
+  {                                                                     \
+    const svn_branch__el_rev_id_t *el_rev_ = arg[i]->el_rev;            \
+    if (el_rev_->rev == SVN_INVALID_REVNUM)                             \
+      return svn_error_createf(SVN_BRANCH__ERR, NULL,                 \
+                               _("%s: '%s': revision number required"), \
+                               op, action->relpath[i]);                 \
+  }
 
 #define VERIFY_REV_UNSPECIFIED(op, i)                                   \
-  if (arg[i]->el_rev->rev != SVN_INVALID_REVNUM)                        \
-    return svn_error_createf(SVN_BRANCH__ERR, NULL,                   \
-                             _("%s: '%s@...': revision number not allowed"), \
-                             op, action->relpath[i]);
+  {                                                                     \
+    const svn_branch__el_rev_id_t *el_rev_ = arg[i]->el_rev;            \
+    if (el_rev_->rev != SVN_INVALID_REVNUM)                             \
+      return svn_error_createf(SVN_BRANCH__ERR, NULL,                 \
+                               _("%s: '%s@...': revision number not allowed"), \
+                               op, action->relpath[i]);                 \
+  }
 
 #define VERIFY_EID_NONEXISTENT(op, i)                                   \
-  if (arg[i]->el_rev->eid != -1)                                        \
-    return svn_error_createf(SVN_BRANCH__ERR, NULL,                   \
-                             _("%s: Element already exists at path '%s'"), \
-                             op, action->relpath[i]);
+  {                                                                     \
+    const svn_branch__el_rev_id_t *el_rev_ = arg[i]->el_rev;            \
+    if (el_rev_->eid != -1)                                             \
+      return svn_error_createf(SVN_BRANCH__ERR, NULL,                 \
+                               _("%s: Element already exists at path '%s'"), \
+                               op, action->relpath[i]);                 \
+  }
 
 #define VERIFY_EID_EXISTS(op, i)                                        \
-  if (arg[i]->el_rev->eid == -1)                                        \
-    return svn_error_createf(SVN_BRANCH__ERR, NULL,                   \
-                             _("%s: Element not found at path '%s%s'"), \
-                             op, action->relpath[i],                    \
-                             action->rev_spec[i].kind == svn_opt_revision_unspecified \
-                               ? "" : "@...");
+  {                                                                     \
+    const svn_branch__el_rev_id_t *el_rev_ = arg[i]->el_rev;            \
+    if (el_rev_->eid == -1)                                             \
+      return svn_error_createf(SVN_BRANCH__ERR, NULL,                 \
+                               _("%s: Element not found at path '%s%s'"), \
+                               op, action->relpath[i],                  \
+                               action->rev_spec[i].kind == svn_opt_revision_unspecified \
+                                 ? "" : "@...");                        \
+  }
 
 #define VERIFY_PARENT_EID_EXISTS(op, i)                                 \
-  if (arg[i]->parent_el_rev->eid == -1)                                 \
-    return svn_error_createf(SVN_BRANCH__ERR, NULL,                   \
-                             _("%s: Element not found at path '%s'"),   \
-                             op, svn_relpath_dirname(action->relpath[i], pool));
+  {                                                                     \
+    const svn_branch__el_rev_id_t *parent_el_rev_ = arg[i]->parent_el_rev; \
+    if (parent_el_rev_->eid == -1)                                      \
+      return svn_error_createf(SVN_BRANCH__ERR, NULL,                 \
+                               _("%s: Element not found at path '%s'"), \
+                               op, svn_relpath_dirname(action->relpath[i], pool)); \
+  }
 
 #define VERIFY_NOT_CHILD_OF_SELF(op, i, j, pool)                        \
-  if (svn_relpath_skip_ancestor(                                        \
-        svn_branch__get_rrpath_by_eid(arg[i]->el_rev->branch,           \
-                                      arg[i]->el_rev->eid, pool),       \
-        svn_branch__get_rrpath_by_eid(arg[j]->parent_el_rev->branch,    \
-                                      arg[j]->parent_el_rev->eid, pool))) \
-    return svn_error_createf(SVN_BRANCH__ERR, NULL,                   \
-                             _("%s: The specified target is nested "    \
-                               "inside the source"), op);
+  {                                                                     \
+    const svn_branch__el_rev_id_t *el_rev_ = arg[i]->el_rev;            \
+    const svn_branch__el_rev_id_t *parent_el_rev_ = arg[j]->parent_el_rev; \
+    if (svn_relpath_skip_ancestor(                                      \
+          svn_branch__get_rrpath_by_eid(el_rev_->branch,                \
+                                        el_rev_->eid, pool),            \
+          svn_branch__get_rrpath_by_eid(parent_el_rev_->branch,         \
+                                        parent_el_rev_->eid, pool)))    \
+      return svn_error_createf(SVN_BRANCH__ERR, NULL,                 \
+                               _("%s: The specified target is nested "  \
+                                 "inside the source"), op);             \
+  }
 
 /* If EL_REV specifies the root element of a nested branch, change EL_REV
  * to specify the corresponding subbranch-root element of its outer branch.
@@ -3396,6 +3811,55 @@ point_to_outer_element_instead(svn_branch__el_rev_id_t *el_rev,
   return SVN_NO_ERROR;
 }
 
+/* Return true if any case of the execute() switch for CODE refers to an
+ * argument's PARENT_EL_REV. Resolving the parent path costs as much as
+ * resolving the argument itself, so it is skipped when unused.
+ */
+static svn_boolean_t
+action_needs_parent_el_rev(action_code_t code)
+{
+  switch (code)
+    {
+    case ACTION_BRANCH:
+    case ACTION_BRANCH_INTO:
+    case ACTION_MKBRANCH:
+    case ACTION_MV:
+    case ACTION_CP:
+    case ACTION_CP_RM:
+    case ACTION_BR_RM:
+    case ACTION_BR_INTO_RM:
+    case ACTION_MKDIR:
+    case ACTION_PUT_FILE:
+      return TRUE;
+    default:
+      return FALSE;
+    }
+}
+
+/* Return true if CODE only reads the branching state, so that executing
+ * it cannot invalidate an already-established sequence point.
+ */
+static svn_boolean_t
+action_is_read_only(action_code_t code)
+{
+  switch (code)
+    {
+    case ACTION_INFO_WC:
+    case ACTION_INFO:
+    case ACTION_LIST_CONFLICTS:
+    case ACTION_LIST_BRANCHES:
+    case ACTION_LIST_BRANCHES_R:
+    case ACTION_LS:
+    case ACTION_LOG:
+    case ACTION_DIFF:
+    case ACTION_CAT:
+    case ACTION_STATUS:
+      return TRUE;
+    default:
+      return FALSE;
+    }
+}
+
 static svn_error_t *
 execute(svnmover_wc_t *wc,
         const apr_array_header_t *actions,
@@ -3405,21 +3869,57 @@ execute(svnmover_wc_t *wc,
         apr_pool_t *pool)
 {
   const char *base_relpath;
-  apr_pool_t *iterpool = svn_pool_create(pool);
+  apr_allocator_t *allocator;
+  apr_pool_t *iterpool;
+  svn_boolean_t need_sequence_point = TRUE;
+  /* Shared empty props hash for actions creating prop-less elements;
+     payload creation dups it, so sharing one instance is safe. */
+  apr_hash_t *empty_props;
+  /* Read buffer reused across 'put' actions; grown on demand. */
+  svn_stringbuf_t *put_buf = NULL;
   int i;
 
+  /* Nothing to do for an empty action list (e.g. a blank line at the
+     interactive prompt); skip the set-up work. */
+  if (actions->nelts == 0)
+    return SVN_NO_ERROR;
+
+  empty_props = apr_hash_make(pool);
+
+  /* Actions make bursts of small transient allocations, and the pool is
+     cleared once per action. Give it a dedicated allocator with a bounded
+     free list so one large action's peak memory is returned to the OS
+     rather than retained for the rest of the (possibly interactive)
+     session. The allocator is owned by the pool and dies with it. */
+  if (apr_allocator_create(&allocator))
+    return svn_error_create(APR_ENOMEM, NULL, NULL);
+  apr_allocator_max_free_set(allocator, SVN_ALLOCATOR_RECOMMENDED_MAX_FREE);
+  iterpool = svn_pool_create_ex(pool, allocator);
+  apr_allocator_owner_set(allocator, iterpool);
+
   base_relpath = svn_uri_skip_ancestor(wc->repos_root_url, anchor_url, pool);
 
   for (i = 0; i < actions->nelts; ++i)
     {
-      action_t *action = APR_ARRAY_IDX(actions, i, action_t *);
+      action_t *action = &APR_ARRAY_IDX(actions, i, action_t);
       int j;
       arg_t *arg[3] = { NULL, NULL, NULL };
+      apr_hash_t *el_rev_cache;
 
       svn_pool_clear(iterpool);
 
-      /* Before translating paths to/from elements, need a sequence point */
-      SVN_ERR(svn_branch__txn_sequence_point(wc->edit_txn, iterpool));
+      /* Before translating paths to/from elements, need a sequence point,
+         unless everything since the last one was read-only. */
+      if (need_sequence_point)
+        {
+          SVN_ERR(svn_branch__txn_sequence_point(wc->edit_txn, iterpool));
+          need_sequence_point = FALSE;
+        }
+      need_sequence_point |= ! action_is_read_only(action->action);
+
+      /* Resolutions memoized within this action only: the next action may
+         change the branching state. */
+      el_rev_cache = apr_hash_make(iterpool);
 
       /* Convert each ACTION[j].{relpath, rev_spec} to
          (EL_REV[j], PARENT_EL_REV[j], PATH_NAME[j], REVNUM[j]),
@@ -3437,16 +3937,19 @@ execute(svnmover_wc_t *wc,
               parent_rrpath = svn_relpath_dirname(rrpath, iterpool);
 
               arg[j]->path_name = svn_relpath_basename(rrpath, NULL);
-              SVN_ERR(find_el_rev_by_rrpath_rev(&arg[j]->el_rev, wc,
-                                                &action->rev_spec[j],
-                                                action->branch_id[j],
-                                                rrpath,
-                                                iterpool, iterpool));
-              SVN_ERR(find_el_rev_by_rrpath_rev(&arg[j]->parent_el_rev, wc,
-                                                &action->rev_spec[j],
-                                                action->branch_id[j],
-                                                parent_rrpath,
-                                                iterpool, iterpool));
+              SVN_ERR(find_el_rev_cached(&arg[j]->el_rev, wc,
+                                         &action->rev_spec[j],
+                                         action->branch_id[j],
+                                         rrpath, el_rev_cache,
+                                         iterpool, iterpool));
+              if (action_needs_parent_el_rev(action->action))
+                SVN_ERR(find_el_rev_cached(&arg[j]->parent_el_rev, wc,
+                                           &action->rev_spec[j],
+                                           action->branch_id[j],
+                                           parent_rrpath, el_rev_cache,
+                                           iterpool, iterpool));
+              else
+                arg[j]->parent_el_rev = NULL;
             }
         }
 
@@ -3683,9 +4186,8 @@ execute(svnmover_wc_t *wc,
           VERIFY_EID_NONEXISTENT("mkbranch", 0);
           VERIFY_PARENT_EID_EXISTS("mkbranch", 0);
           {
-            apr_hash_t *props = apr_hash_make(iterpool);
             svn_element__payload_t *payload
-              = svn_element__payload_create_dir(props, iterpool);
+              = svn_element__payload_create_dir(empty_props, iterpool);
 
             SVN_ERR(do_mkbranch(NULL, wc->edit_txn,
                                 arg[0]->parent_el_rev->branch,
@@ -3839,7 +4341,7 @@ execute(svnmover_wc_t *wc,
           SVN_ERR(do_mkdir(wc->edit_txn,
                            arg[0]->parent_el_rev->branch,
                            arg[0]->parent_el_rev->eid, arg[0]->path_name,
-                           iterpool));
+                           empty_props, iterpool));
           break;
 
         case ACTION_PUT_FILE:
@@ -3850,6 +4352,7 @@ execute(svnmover_wc_t *wc,
                               arg[1]->el_rev,
                               arg[1]->parent_el_rev,
                               arg[1]->path_name,
+                              &put_buf, pool,
                               iterpool));
           break;
 
@@ -3936,8 +4439,13 @@ static const char *
 sanitize_url(const char *url,
              apr_pool_t *pool)
 {
+  /* The escaping steps return URL itself when there is nothing to
+     escape; skipping canonicalization for already-canonical input makes
+     the whole chain copy-free in the common case. */
   url = svn_path_uri_from_iri(url, pool);
   url = svn_path_uri_autoescape(url, pool);
+  if (svn_uri_is_canonical(url, pool))
+    return url;
   return svn_uri_canonicalize(url, pool);
 }
 
@@ -3954,12 +4462,23 @@ help_for_subcommand(const action_defn_t *action, apr_pool_t *pool)
 static void
 usage_actions_only(FILE *stream, apr_pool_t *pool)
 {
-  int i;
+  static const char *cached = NULL;
+
+  if (! cached)
+    {
+      /* Assembled once: 'help' can be typed repeatedly at the prompt.
+         The cache gets a private global pool, as the caller's pool may
+         be transient. */
+      apr_pool_t *cache_pool = svn_pool_create(NULL);
+      svn_stringbuf_t *buf = svn_stringbuf_create_empty(pool);
+      int i;
 
-  for (i = 0; i < sizeof (action_defn) / sizeof (action_defn[0]); i++)
-    svn_error_clear(svn_cmdline_fputs(
-                      help_for_subcommand(&action_defn[i], pool),
-                      stream, pool));
+      for (i = 0; i < ACTION_DEFN_COUNT; i++)
+        svn_stringbuf_appendcstr(buf,
+                                 help_for_subcommand(&action_defn[i], pool));
+      cached = apr_pstrdup(cache_pool, buf->data);
+    }
+  svn_error_clear(svn_cmdline_fputs(cached, stream, pool));
 }
 
 /* Print a usage message on STREAM. */
@@ -4124,16 +4643,23 @@ parse_actions(apr_array_header_t **actions,
               apr_pool_t *pool)
 {
   int i;
+  apr_pool_t *iterpool = svn_pool_create(pool);
 
-  *actions = apr_array_make(pool, 1, sizeof(action_t *));
+  /* There can be no more actions than argument words. The actions are
+     stored by value, contiguously, so that the consumer loop in
+     execute() walks a flat array instead of chasing per-action
+     pointers. */
+  *actions = apr_array_make(pool, action_args->nelts, sizeof(action_t));
 
   for (i = 0; i < action_args->nelts; ++i)
     {
       int j, k, num_url_args;
       const char *action_string = APR_ARRAY_IDX(action_args, i, const char *);
-      action_t *action = apr_pcalloc(pool, sizeof(*action));
+      action_t *action;
       const char *cp_from_rev = NULL;
 
+      svn_pool_clear(iterpool);
+
       /* First, parse the action. Handle some special actions immediately;
          handle normal subcommands by looking them up in the table. */
       if (! strcmp(action_string, "?") || ! strcmp(action_string, "h")
@@ -4155,19 +4681,20 @@ parse_actions(apr_array_header_t **actions,
           svnmover_notify("verbose mode %s", quiet ? "off" : "on");
           continue;
         }
-      for (j = 0; j < sizeof(action_defn) / sizeof(action_defn[0]); j++)
-        {
-          if (strcmp(action_string, action_defn[j].name) == 0)
-            {
-              action->action = action_defn[j].code;
-              num_url_args = action_defn[j].num_args;
-              break;
-            }
-        }
-      if (j == sizeof(action_defn) / sizeof(action_defn[0]))
-        return svn_error_createf(SVN_ERR_INCORRECT_PARAMS, NULL,
-                                 "'%s' is not an action; try 'help'.",
-                                 action_string);
+      {
+        const action_defn_t *defn = find_action_defn(action_string);
+
+        if (! defn)
+          return svn_error_createf(SVN_ERR_INCORRECT_PARAMS, NULL,
+                                   "'%s' is not an action; try 'help'.",
+                                   action_string);
+        /* Append a new zeroed action and fill it in place. */
+        action = &APR_ARRAY_PUSH(*actions, action_t);
+        memset(action, 0, sizeof(*action));
+        action->action = defn->code;
+        num_url_args = defn->num_args;
+        j = (int)(defn - action_defn);
+      }
 
       action->action_args = apr_array_make(pool, 0, sizeof(const char *));
       APR_ARRAY_PUSH(action->action_args, const char *) = action_string;
@@ -4193,7 +4720,9 @@ parse_actions(apr_array_header_t **actions,
 
           if (cp_from_rev && k == 0)
             {
-              path = apr_psprintf(pool, "%s@%s", path, cp_from_rev);
+              /* A transient join: svn_opt_parse_path dups the path part
+                 it keeps into POOL. */
+              path = apr_psprintf(iterpool, "%s@%s", path, cp_from_rev);
             }
 
           SVN_ERR(svn_opt_parse_path(&action->rev_spec[k], &path, path, pool));
@@ -4229,9 +4758,8 @@ parse_actions(apr_array_header_t **actions,
             }
           action->relpath[k] = path;
         }
-
-      APR_ARRAY_PUSH(*actions, action_t *) = action;
     }
+  svn_pool_destroy(iterpool);
 
   return SVN_NO_ERROR;
 }
@@ -4250,13 +4778,14 @@ static void
 linenoise_completion(const char *buf, linenoiseCompletions *lc)
 {
   int i;
+  apr_size_t buflen = strlen(buf);
 
   for (i = 0; i < sizeof(special_commands) / sizeof(special_commands[0]); i++)
     {
       /* Suggest each command that matches (and is longer than) what the
          user has already typed. Add a space. */
-      if (strncmp(buf, special_commands[i], strlen(buf)) == 0
-          && strlen(special_commands[i]) > strlen(buf))
+      if (strncmp(buf, special_commands[i], buflen) == 0
+          && strlen(special_commands[i]) > buflen)
         {
           static char completion[100];
 
@@ -4266,20 +4795,39 @@ linenoise_completion(const char *buf, linenoiseCompletions *lc)
         }
     }
 
-  for (i = 0; i < sizeof(action_defn) / sizeof(action_defn[0]); i++)
-    {
-      /* Suggest each command that matches (and is longer than) what the
-         user has already typed. Add a space. */
-      if (strncmp(buf, action_defn[i].name, strlen(buf)) == 0
-          && strlen(action_defn[i].name) > strlen(buf))
-        {
-          static char completion[100];
+  {
+    const action_defn_t **defn_by_name = action_defn_index();
+    int lo = 0, hi = ACTION_DEFN_COUNT;
 
-          apr_cpystrn(completion, action_defn[i].name, 99);
-          strcat(completion, " ");
-          linenoiseAddCompletion(lc, completion);
-        }
-    }
+    /* Binary-search the first name >= BUF in the sorted index; the names
+       sharing the prefix form a contiguous run from there. */
+    while (lo < hi)
+      {
+        int mid = (lo + hi) / 2;
+
+        if (strncmp(defn_by_name[mid]->name, buf, buflen) < 0)
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+
+    for (i = lo;
+         i < ACTION_DEFN_COUNT
+           && strncmp(buf, defn_by_name[i]->name, buflen) == 0;
+         i++)
+      {
+        /* Suggest each command that matches (and is longer than) what the
+           user has already typed. Add a space. */
+        if (strlen(defn_by_name[i]->name) > buflen)
+          {
+            static char completion[100];
+
+            apr_cpystrn(completion, defn_by_name[i]->name, 99);
+            strcat(completion, " ");
+            linenoiseAddCompletion(lc, completion);
+          }
+      }
+  }
 }
 #endif
 
@@ -4295,6 +4843,8 @@ read_words(apr_array_header_t **words,
   svn_error_t *err;
   const char *input;
 
+  /* Make sure all notifications are visible before prompting. */
+  fflush(stdout);
   settext(TEXT_FG_YELLOW);
   err = svnmover_prompt_user(&input, prompt, result_pool);
   settext(TEXT_RESET);
@@ -4310,6 +4860,55 @@ read_words(apr_array_header_t **words,
   return SVN_NO_ERROR;
 }
 
+/* Append each non-empty line of the LEN bytes at DATA to ARR, dup'd
+ * into POOL. A line ends at '\n', ignoring one preceding '\r' if any.
+ *
+ * Cheaper than the generic multi-delimiter splitter for large inputs:
+ * memchr scans many bytes per cycle in any decent libc.
+ */
+static void
+split_lines(apr_array_header_t *arr,
+            const char *data,
+            apr_size_t len,
+            apr_pool_t *pool)
+{
+  const char *p = data;
+  const char *end = data + len;
+
+  while (p < end)
+    {
+      const char *eol = memchr(p, '\n', end - p);
+      const char *line_end = eol ? eol : end;
+
+      if (line_end > p && line_end[-1] == '\r')
+        line_end--;
+      if (line_end > p)
+        APR_ARRAY_PUSH(arr, const char *)
+          = apr_pstrmemdup(pool, p, line_end - p);
+      p = eol ? eol + 1 : end;
+    }
+}
+
+/* Set *RESULT to ARG converted to UTF-8, allocated in POOL.
+ *
+ * A purely-ASCII ARG is the same in every ASCII-compatible native
+ * encoding, so in that common case skip the transcoder and its
+ * per-call handle lookup and just copy the string.
+ */
+static svn_error_t *
+arg_to_utf8(const char **result,
+            const char *arg,
+            apr_pool_t *pool)
+{
+  const char *p;
+
+  for (p = arg; *p; p++)
+    if ((unsigned char)*p >= 0x80)
+      return svn_utf_cstring_to_utf8(result, arg, pool);
+  *result = apr_pstrdup(pool, arg);
+  return SVN_NO_ERROR;
+}
+
 /*
  * On success, leave *EXIT_CODE untouched and return SVN_NO_ERROR. On error,
  * either return an error to be displayed, or set *EXIT_CODE to non-zero and
@@ -4390,11 +4989,12 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
   svn_tristate_t coloured_output = svn_tristate_false;
   svnmover_wc_t *wc;
   svn_boolean_t read_pass_from_stdin = FALSE;
+  apr_pool_t *iterpool;
 
   /* Check library versions */
   SVN_ERR(check_lib_versions());
 
-  config_options = apr_array_make(pool, 0,
+  config_options = apr_array_make(pool, 4,
                                   sizeof(svn_cmdline__config_argument_t*));
 
   apr_getopt_init(&opts, pool, argc, argv);
@@ -4419,26 +5019,33 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
           quiet = TRUE;
           break;
         case 'm':
-          SVN_ERR(svn_utf_cstring_to_utf8(&message, arg, pool));
+          SVN_ERR(arg_to_utf8(&message, arg, pool));
           break;
         case 'F':
           {
             const char *filename;
-            SVN_ERR(svn_utf_cstring_to_utf8(&filename, arg, pool));
-            SVN_ERR(svn_stringbuf_from_file2(&filedata, filename, pool));
+            apr_pool_t *scratch = svn_pool_create(pool);
+            svn_stringbuf_t *contents;
+
+            /* Read via a subpool so the long-lived pool keeps only an
+               exact-sized copy, not the read buffer. */
+            SVN_ERR(arg_to_utf8(&filename, arg, scratch));
+            SVN_ERR(svn_stringbuf_from_file2(&contents, filename, scratch));
+            filedata = svn_stringbuf_dup(contents, pool);
+            svn_pool_destroy(scratch);
           }
           break;
         case 'u':
-          username = apr_pstrdup(pool, arg);
+          SVN_ERR(arg_to_utf8(&username, arg, pool));
           break;
         case 'p':
-          password = apr_pstrdup(pool, arg);
+          SVN_ERR(arg_to_utf8(&password, arg, pool));
           break;
         case auth_password_from_stdin_opt:
           read_pass_from_stdin = TRUE;
           break;
         case 'U':
-          SVN_ERR(svn_utf_cstring_to_utf8(&anchor_url, arg, pool));
+          SVN_ERR(arg_to_utf8(&anchor_url, arg, pool));
           if (! svn_path_is_url(anchor_url))
             return svn_error_createf(SVN_ERR_INCORRECT_PARAMS, NULL,
                                      "'%s' is not a URL", anchor_url);
@@ -4446,17 +5053,19 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
           break;
         case 'r':
           {
-            const char *saved_arg = arg;
-            char *digits_end = NULL;
-            while (*arg == 'r')
-              arg++;
-            base_revision = strtol(arg, &digits_end, 10);
-            if ((! SVN_IS_VALID_REVNUM(base_revision))
-                || (! digits_end)
-                || *digits_end)
-              return svn_error_createf(SVN_ERR_CL_ARG_PARSING_ERROR, NULL,
-                                       _("Invalid revision number '%s'"),
-                                       saved_arg);
+            const char *digits = arg;
+            const char *end = NULL;
+
+            while (*digits == 'r')
+              digits++;
+            err = svn_revnum_parse(&base_revision, digits, &end);
+            if (err || *end)
+              {
+                svn_error_clear(err);
+                return svn_error_createf(SVN_ERR_CL_ARG_PARSING_ERROR, NULL,
+                                         _("Invalid revision number '%s'"),
+                                         arg);
+              }
           }
           break;
         case 'B':
@@ -4467,7 +5076,7 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
           SVN_ERR(svn_opt_parse_revprop(&revprops, arg, pool));
           break;
         case 'X':
-          SVN_ERR(svn_utf_cstring_to_utf8(&extra_args_file, arg, pool));
+          SVN_ERR(arg_to_utf8(&extra_args_file, arg, pool));
           break;
         case non_interactive_opt:
           non_interactive = TRUE;
@@ -4479,7 +5088,7 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
           trust_unknown_ca = TRUE;
           break;
         case trust_server_cert_failures_opt:
-          SVN_ERR(svn_utf_cstring_to_utf8(&opt_arg, arg, pool));
+          SVN_ERR(arg_to_utf8(&opt_arg, arg, pool));
           SVN_ERR(svn_cmdline__parse_trust_options(
                       &trust_unknown_ca,
                       &trust_cn_mismatch,
@@ -4489,10 +5098,10 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
                       opt_arg, pool));
           break;
         case config_dir_opt:
-          SVN_ERR(svn_utf_cstring_to_utf8(&config_dir, arg, pool));
+          SVN_ERR(arg_to_utf8(&config_dir, arg, pool));
           break;
         case config_inline_opt:
-          SVN_ERR(svn_utf_cstring_to_utf8(&opt_arg, arg, pool));
+          SVN_ERR(arg_to_utf8(&opt_arg, arg, pool));
           SVN_ERR(svn_cmdline__parse_config_option(config_options, opt_arg,
                                                    "svnmover: ", pool));
           break;
@@ -4503,7 +5112,7 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
           show_version = TRUE;
           break;
         case ui_opt:
-          SVN_ERR(svn_utf_cstring_to_utf8(&opt_arg, arg, pool));
+          SVN_ERR(arg_to_utf8(&opt_arg, arg, pool));
           SVN_ERR(svn_token__from_word_err(&the_ui_mode, ui_mode_map, opt_arg));
           break;
         case colour_opt:
@@ -4599,6 +5208,10 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
       SVN_ERR(svn_cmdline__stdin_readline(&password, pool, pool));
     }
 
+  /* One-time, cold set-up from here to the action loop: the auth baton
+   * and config cannot be deferred to the first write action, because
+   * wc_create() below opens the RA session (and may authenticate) even
+   * for a session that only ever runs read-only commands. */
   SVN_ERR(svn_client_create_context2(&ctx, cfg_hash, pool));
 
   cfg_config = svn_hash_gets(cfg_hash, SVN_CONFIG_CATEGORY_CONFIG);
@@ -4653,12 +5266,16 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
   action_args = apr_array_make(pool, opts->argc, sizeof(const char *));
   if (extra_args_file)
     {
+      apr_pool_t *scratch = svn_pool_create(pool);
       svn_stringbuf_t *contents, *contents_utf8;
 
-      SVN_ERR(svn_stringbuf_from_file2(&contents, extra_args_file, pool));
-      SVN_ERR(svn_utf_stringbuf_to_utf8(&contents_utf8, contents, pool));
-      svn_cstring_split_append(action_args, contents_utf8->data, "\n\r",
-                               FALSE, pool);
+      /* Only the split words survive (dup'd into POOL); the two
+         whole-file buffers are discarded with the subpool. */
+      SVN_ERR(svn_stringbuf_from_file2(&contents, extra_args_file, scratch));
+      SVN_ERR(svn_utf_stringbuf_to_utf8(&contents_utf8, contents, scratch));
+      split_lines(action_args, contents_utf8->data, contents_utf8->len,
+                  pool);
+      svn_pool_destroy(scratch);
     }
 
   interactive_actions = !(opts->ind < opts->argc
@@ -4677,16 +5294,20 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
                     branch_id,
                     ctx, pool, pool));
 
+  /* The parsed argument arrays and action structs are transient; keep
+     them in a subpool reclaimed each time round the loop so a long
+     interactive session does not grow without bound. */
+  iterpool = svn_pool_create(pool);
   do
     {
       /* Parse arguments -- converting local style to internal style,
        * repos-relative URLs to regular URLs, etc. */
       err = svn_client_args_to_target_array2(&action_args, opts, action_args,
-                                             ctx, FALSE, pool);
+                                             ctx, FALSE, iterpool);
       if (! err)
-        err = parse_actions(&actions, action_args, pool);
+        err = parse_actions(&actions, action_args, iterpool);
       if (! err)
-        err = execute(wc, actions, anchor_url, revprops, ctx, pool);
+        err = execute(wc, actions, anchor_url, revprops, ctx, iterpool);
       if (err)
         {
           if (err->apr_err == SVN_ERR_AUTHN_FAILED && non_interactive)
@@ -4706,13 +5327,18 @@ sub_main(int *exit_code, int argc, const char *argv[], apr_pool_t *pool)
             SVN_ERR(err);
         }
 
+      /* This batch of actions is done with; reclaim it (and the previous
+         prompt line) before reading the next batch into the subpool. */
+      svn_pool_clear(iterpool);
+
       /* Possibly read more actions from the command line */
       if (interactive_actions)
         {
-          SVN_ERR(read_words(&action_args, "svnmover> ", pool));
+          SVN_ERR(read_words(&action_args, "svnmover> ", iterpool));
         }
     }
   while (interactive_actions && action_args);
+  svn_pool_destroy(iterpool);
 
   /* Final commit */
   err = commit(NULL, wc, revprops, pool);
@@ -4734,7 +5360,10 @@ main(int argc, const char *argv[])
     return EXIT_FAILURE;
 
   /* Create our top-level pool.  Use a separate mutexless allocator,
-   * given this application is single threaded.
+   * given this application is single threaded.  The allocator's free
+   * list is capped at SVN_ALLOCATOR_RECOMMENDED_MAX_FREE, so large
+   * transient allocations (e.g. a big 'put' file) are returned to the
+   * OS rather than hoarded across a long interactive session.
    */
   pool = apr_allocator_owner_get(svn_pool_create_allocator(FALSE));
 